@@ -0,0 +1,92 @@
+#include "hermes1d.h"
+
+// ********************************************************************
+
+// This example follows the solutions of the Bratu problem
+//   -u'' = lambda * exp(u),  u(0) = u(1) = 0
+// from lambda = 0 along the lower branch, around the turning point at
+// lambda = 3.51 and back along the upper branch, by pseudo-arclength
+// continuation. Every point starts from the secant prediction of the last
+// two, so only a few Newton iterations are needed per point.
+
+// general input:
+static int NUM_EQ = 1;
+int Nelem = 20;                        // number of elements
+double A = 0, B = 1;                   // domain end points
+int P_INIT = 4;                        // initial polynomal degree
+int N_STEPS = 40;                      // number of continuation steps
+
+// Tolerance for Newton's method
+double TOL = 1e-10;
+
+// ********************************************************************
+
+double jacobian(int num, double *x, double *weights, 
+                double *u, double *dudx, double *v, double *dvdx, 
+                double *u_prev, double *du_prevdx, void *user_data)
+{
+  double lambda = *(double *) user_data;
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += (dudx[i]*dvdx[i] - lambda*exp(u_prev[i])*u[i]*v[i])*weights[i];
+  return val;
+};
+
+double residual_vol(int num, double *x, double *weights, 
+                double *u_prev, double *du_prevdx, double *v, double *dvdx,
+                void *user_data)
+{
+  double lambda = *(double *) user_data;
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += (du_prevdx[i]*dvdx[i] - lambda*exp(u_prev[i])*v[i])*weights[i];
+  return val;
+};
+
+/******************************************************************************/
+int main() {
+  // create mesh
+  Mesh mesh(NUM_EQ);
+  mesh.create(A, B, Nelem);
+  mesh.set_poly_orders(P_INIT);
+
+  // boundary conditions
+  mesh.set_bc_left_dirichlet(0, 0);
+  mesh.set_bc_right_dirichlet(0, 0);
+  mesh.assign_dofs();
+  int Ndof = mesh.get_n_dof();
+  printf("Ndof = %d\n", Ndof);
+
+  // the forms read the continuation parameter through user_data
+  double lambda = 0;
+  DiscreteProblem dp(NUM_EQ, &mesh);
+  dp.add_matrix_form(0, 0, jacobian, 2, 2, &lambda);
+  dp.add_vector_form(0, residual_vol, 2, 2, &lambda);
+
+  double *y = new double[Ndof];
+  for (int i=0; i<Ndof; i++) y[i] = 0;
+  Continuation cont(&dp, &lambda, TOL);
+  cont.set_step(0.2, 1e-6, 0.5);
+  cont.set_arclength(true);
+  cont.start(0, y);
+
+  Linearizer l(&mesh);
+  int total_iter = 0;
+  for (int step=1; step<=N_STEPS; step++) {
+    int it = cont.step(y);
+    if (it < 0) {
+      printf("Continuation failed at lambda = %g\n", cont.get_lambda());
+      break;
+    }
+    total_iter += it;
+    // maximum of the solution, at x = 1/2 (left end of the middle element)
+    double x_mid, u_mid;
+    l.eval_approx(mesh.get_elems() + Nelem/2, -1, y, x_mid, u_mid);
+    printf("Step %d: lambda = %.6f, u(1/2) = %.6f, Newton iterations: %d\n",
+           step, cont.get_lambda(), u_mid, it);
+  }
+  printf("Average number of Newton iterations: %g\n",
+         (double) total_iter / N_STEPS);
+  printf("Done.\n");
+  return 1;
+}
@@ -0,0 +1,172 @@
+#include "hermes1d.h"
+
+// ********************************************************************
+
+// This example solves the nonlinear problem -u'' + k*u^3 = sin(x) with
+// u(A) = 0 and the Newton condition alpha*u'(B) + u(B) = beta for many
+// values of k, alpha and beta at once. The solves run concurrently on all
+// OpenMP threads; the parameters reach the weak forms through user_data.
+// The ensemble is solved twice: one member per thread at a time, and
+// BATCH_WIDTH members per thread in lockstep with batched forms, which
+// evaluate all members in the vector lanes.
+
+// general input:
+static int NUM_EQ = 1;
+int Nelem = 100;                       // number of elements
+double A = 0, B = 2*M_PI;              // domain end points
+int P_INIT = 3;                        // initial polynomal degree
+int N_MEMBERS = 1000;                  // number of parameter sets
+
+// Tolerance for Newton's method
+double TOL = 1e-8;
+
+// parameters of one member of the ensemble
+struct Params {
+  double k, alpha, beta;
+};
+
+// ********************************************************************
+
+double jacobian(int num, double *x, double *weights, 
+                double *u, double *dudx, double *v, double *dvdx, 
+                double *u_prev, double *du_prevdx, void *user_data)
+{
+  Params *p = (Params *) user_data;
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += (dudx[i]*dvdx[i] + 3*p->k*u_prev[i]*u_prev[i]*u[i]*v[i])*weights[i];
+  return val;
+};
+
+double residual_vol(int num, double *x, double *weights, 
+                double *u_prev, double *du_prevdx, double *v, double *dvdx,
+                void *user_data)
+{
+  Params *p = (Params *) user_data;
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += (du_prevdx[i]*dvdx[i] + p->k*u_prev[i]*u_prev[i]*u_prev[i]*v[i]
+            - sin(x[i])*v[i])*weights[i];
+  return val;
+};
+
+double jacobian_surf_right(double x, double u, double dudx,
+        double v, double dvdx, double u_prev, double du_prevdx,
+        void *user_data)
+{
+  Params *p = (Params *) user_data;
+  return (1/p->alpha)*u*v;
+}
+
+double residual_surf_right(double x, double u_prev, double du_prevdx, double v,
+        double dvdx, void *user_data)
+{
+  Params *p = (Params *) user_data;
+  return ((1/p->alpha)*u_prev - p->beta/p->alpha) * v; 
+}
+
+// registers the weak forms of one member
+void setup(DiscreteProblem *dp, void *params)
+{
+  dp->add_matrix_form(0, 0, jacobian, 2, 4, params);
+  dp->add_vector_form(0, residual_vol, 0, 4, params);
+  dp->add_matrix_form_surf(0, 0, jacobian_surf_right, BOUNDARY_RIGHT, params);
+  dp->add_vector_form_surf(0, residual_surf_right, BOUNDARY_RIGHT, params);
+}
+
+// batched versions of the volumetric forms: lane e belongs to the member
+// with the parameters ((void **) user_data)[e], the arrays are stored
+// point-major, lane-minor (see form_utils.h)
+void jacobian_batch(int num, double *x, double *weights,
+                double *u, double *dudx, double *v, double *dvdx,
+                double *u_prev, double *du_prevdx, double *result,
+                void *user_data)
+{
+  const int W = BATCH_WIDTH;
+  void **lane_params = (void **) user_data;
+  double k[W];
+  for (int e=0; e<W; e++) k[e] = ((Params *) lane_params[e])->k;
+  for (int e=0; e<W; e++) result[e] = 0;
+  for (int i=0; i<num; i++)
+    for (int e=0; e<W; e++) {
+      int l = i*W + e;
+      result[e] += (dudx[l]*dvdx[l] + 3*k[e]*u_prev[l]*u_prev[l]*u[l]*v[l])
+                   *weights[l];
+    }
+}
+
+void residual_vol_batch(int num, double *x, double *weights,
+                double *u_prev, double *du_prevdx, double *v, double *dvdx,
+                double *result, void *user_data)
+{
+  const int W = BATCH_WIDTH;
+  void **lane_params = (void **) user_data;
+  double k[W];
+  for (int e=0; e<W; e++) k[e] = ((Params *) lane_params[e])->k;
+  for (int e=0; e<W; e++) result[e] = 0;
+  for (int i=0; i<num; i++)
+    for (int e=0; e<W; e++) {
+      int l = i*W + e;
+      result[e] += (du_prevdx[l]*dvdx[l] + k[e]*u_prev[l]*u_prev[l]*u_prev[l]*v[l]
+                    - sin(x[l])*v[l])*weights[l];
+    }
+}
+
+// registers the weak forms of BATCH_WIDTH members solved in lockstep
+void setup_batch(DiscreteProblem *dp, void **lane_params)
+{
+  dp->add_matrix_form_batch(0, 0, jacobian_batch, 2, 4, lane_params);
+  dp->add_vector_form_batch(0, residual_vol_batch, 0, 4, lane_params);
+  dp->add_matrix_form_surf(0, 0, jacobian_surf_right, BOUNDARY_RIGHT,
+                           lane_params);
+  dp->add_vector_form_surf(0, residual_surf_right, BOUNDARY_RIGHT,
+                           lane_params);
+}
+
+/******************************************************************************/
+int main() {
+  // create mesh
+  Mesh mesh(NUM_EQ);
+  mesh.create(A, B, Nelem);
+  mesh.set_poly_orders(P_INIT);
+
+  // boundary conditions
+  mesh.set_bc_left_dirichlet(0, 0);
+  mesh.set_bc_right_natural(0);
+  mesh.assign_dofs();
+  int Ndof = mesh.get_n_dof();
+  printf("Ndof = %d\n", Ndof);
+
+  // parameter sweep
+  Params *params = new Params[N_MEMBERS];
+  void **param_ptrs = new void*[N_MEMBERS];
+  for (int k=0; k<N_MEMBERS; k++) {
+    params[k].k = 0.1 + 0.9*k/N_MEMBERS;
+    params[k].alpha = 1 + (k % 10);
+    params[k].beta = 0.1*(k % 7);
+    param_ptrs[k] = params + k;
+  }
+
+  double *y = new double[(size_t) N_MEMBERS*Ndof];
+  EnsembleSolver ensemble(&mesh, setup, TOL);
+  int n_converged = ensemble.solve(N_MEMBERS, param_ptrs, y);
+  printf("Converged: %d of %d\n", n_converged, N_MEMBERS);
+  printf("Newton iterations of the first member: %d\n",
+         ensemble.get_iterations(0));
+  printf("Throughput: %g solves per second\n",
+         ensemble.get_solves_per_second());
+
+  EnsembleSolver ensemble_batch(&mesh, setup_batch, TOL);
+  n_converged = ensemble_batch.solve(N_MEMBERS, param_ptrs, y);
+  printf("Lockstep: converged: %d of %d\n", n_converged, N_MEMBERS);
+  printf("Lockstep: throughput: %g solves per second\n",
+         ensemble_batch.get_solves_per_second());
+
+  Linearizer l(&mesh);
+  const char *out_filename = "solution.gp";
+  l.plot_solution(out_filename, y);
+
+  printf("Output written to %s.\n", out_filename);
+  printf("Done.\n");
+  return 1;
+}
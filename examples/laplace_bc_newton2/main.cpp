@@ -9,11 +9,12 @@ int Nelem = 30;                         // number of elements
 double A = 0, B = 2*M_PI;              // domain end points
 int P_INIT = 1;                        // initial polynomal degree
 
-// boundary conditions
-double val_newton_alpha_left = 2;
-double val_newton_beta_left = -2;
-double val_newton_alpha_right = 1;
-double val_newton_beta_right = 1;
+// boundary conditions, passed to the surface forms as user_data
+struct NewtonBC {
+  double alpha, beta;
+};
+NewtonBC bc_left = {2, -2};
+NewtonBC bc_right = {1, 1};
 
 // Tolerance for Newton's method
 double TOL = 1e-5;
@@ -79,30 +80,19 @@ double residual_vol(int num, double *x, double *weights,
   return val;
 };
 
-double jacobian_surf_left(double x, double u, double dudx,
-        double v, double dvdx, double u_prev, double du_prevdx,
-        void *user_data)
-{
-  return (1/val_newton_alpha_left)*u*v;
-}
-
-double jacobian_surf_right(double x, double u, double dudx,
+double jacobian_surf(double x, double u, double dudx,
         double v, double dvdx, double u_prev, double du_prevdx,
         void *user_data)
 {
-  return (1/val_newton_alpha_right)*u*v;
-}
-
-double residual_surf_left(double x, double u_prev, double du_prevdx, double v,
-        double dvdx, void *user_data)
-{
-  return -(val_newton_beta_left/val_newton_alpha_left) * v; 
+  NewtonBC *bc = (NewtonBC *) user_data;
+  return (1/bc->alpha)*u*v;
 }
 
-double residual_surf_right(double x, double u_prev, double du_prevdx, double v,
+double residual_surf(double x, double u_prev, double du_prevdx, double v,
         double dvdx, void *user_data)
 {
-  return -(val_newton_beta_right/val_newton_alpha_right) * v; 
+  NewtonBC *bc = (NewtonBC *) user_data;
+  return -(bc->beta/bc->alpha) * v; 
 }
 
 /******************************************************************************/
@@ -121,10 +111,10 @@ int main() {
   DiscreteProblem dp(NUM_EQ, &mesh);
   dp.add_matrix_form(0, 0, jacobian);
   dp.add_vector_form(0, residual_vol);
-  dp.add_matrix_form_surf(0, 0, jacobian_surf_left, BOUNDARY_LEFT);
-  dp.add_vector_form_surf(0, residual_surf_left, BOUNDARY_LEFT);
-  dp.add_matrix_form_surf(0, 0, jacobian_surf_right, BOUNDARY_RIGHT);
-  dp.add_vector_form_surf(0, residual_surf_right, BOUNDARY_RIGHT);
+  dp.add_matrix_form_surf(0, 0, jacobian_surf, BOUNDARY_LEFT, &bc_left);
+  dp.add_vector_form_surf(0, residual_surf, BOUNDARY_LEFT, &bc_left);
+  dp.add_matrix_form_surf(0, 0, jacobian_surf, BOUNDARY_RIGHT, &bc_right);
+  dp.add_vector_form_surf(0, residual_surf, BOUNDARY_RIGHT, &bc_right);
 
   // variable for the total number of DOF 
   int Ndof = mesh.get_n_dof();
@@ -0,0 +1,131 @@
+#include "hermes1d.h"
+
+// ********************************************************************
+
+// This example solves the same problem as laplace_bc_newton, but the
+// Newton steps are computed by the frontal solver which assembles and
+// eliminates the elements one by one and never stores the global matrix.
+
+// general input:
+static int NUM_EQ = 1;
+int Nelem = 1000;                      // number of elements
+double A = 0, B = 2*M_PI;              // domain end points
+int P_INIT = 3;                        // initial polynomal degree
+
+// boundary conditions
+double val_dir_left = 0;
+double val_newton_alpha = 1;
+double val_newton_beta = 1;
+
+// Tolerance for Newton's method
+double TOL = 1e-5;
+
+// right-hand side
+double f(double x) {
+  return sin(x);
+}
+
+// ********************************************************************
+
+// bilinear form for the Jacobi matrix 
+// num...number of Gauss points in element
+// x[]...Gauss points
+// weights[]...Gauss weights for points in x[]
+// u...basis function
+// v...test function
+// u_prev...previous solution
+double jacobian(int num, double *x, double *weights, 
+                double *u, double *dudx, double *v, double *dvdx, 
+                double *u_prev, double *du_prevdx, void *user_data)
+{
+  // the helpers of form_utils.h sum over the padded quadrature buffers
+  return quad_dot(num, weights, dudx, dvdx);
+};
+
+// all test functions at once: f is evaluated only once per quadrature point
+void residual_vol(int num, double *x, double *weights,
+                double *u_prev, double *du_prevdx, int n_test, double *v,
+                double *dvdx, double *result, void *user_data)
+{
+  int n = quad_padded(num);
+  double fw[n] QUAD_ALIGNED;
+  for(int k = 0; k<n; k++) fw[k] = f(x[k])*weights[k];
+  for(int i = 0; i<n_test; i++) {
+    double *v_i = v + i*n, *dvdx_i = dvdx + i*n;
+    result[i] = quad_dot(num, weights, du_prevdx, dvdx_i) -
+                quad_dot(num, fw, v_i);
+  }
+};
+
+double jacobian_surf_right(double x, double u, double dudx,
+        double v, double dvdx, double u_prev, double du_prevdx,
+        void *user_data)
+{
+  return (1/val_newton_alpha)*u*v;
+}
+
+double residual_surf_right(double x, double u_prev, double du_prevdx, double v,
+        double dvdx, void *user_data)
+{
+  return ((1/val_newton_alpha)*u_prev - val_newton_beta/val_newton_alpha) * v; 
+}
+
+/******************************************************************************/
+int main() {
+  // create mesh
+  Mesh mesh(NUM_EQ);
+  mesh.create(A, B, Nelem);
+  mesh.set_poly_orders(P_INIT);
+
+  // boundary conditions
+  mesh.set_bc_left_dirichlet(0, val_dir_left);
+  mesh.set_bc_right_natural(0);
+  mesh.assign_dofs();
+
+  // register weak forms; the Jacobi matrix does not depend on the
+  // solution, so it is only integrated once
+  DiscreteProblem dp(NUM_EQ, &mesh);
+  dp.add_matrix_form_linear(0, 0, jacobian);
+  dp.add_vector_form_all(0, residual_vol);
+  dp.add_matrix_form_surf(0, 0, jacobian_surf_right, BOUNDARY_RIGHT);
+  dp.add_vector_form_surf(0, residual_surf_right, BOUNDARY_RIGHT);
+
+  // variable for the total number of DOF 
+  int Ndof = mesh.get_n_dof();
+  printf("Ndof = %d\n", Ndof);
+
+  // allocate the solution and the Newton update
+  double *y_prev = new double[Ndof];
+  double *dy = new double[Ndof];
+
+  // zero initial condition for the Newton's method
+  for(int i=0; i<Ndof; i++) y_prev[i] = 0; 
+
+  FrontalSolver solver(&dp);
+  int newton_iterations = 1;
+  // Newton's loop
+  while (1) {
+    // assemble and solve the Newton system element by element,
+    // 'dy' is the Newton update and res_norm the residual L2 norm
+    double res_norm = solver.solve(y_prev, dy);
+
+    // if residual norm less than TOL, quit
+    // latest solution is in y_prev
+    printf("Residual L2 norm: %.15f\n", res_norm);
+    if(res_norm < TOL) break;
+
+    // updating y_prev by the Newton update
+    for(int i=0; i<Ndof; i++) y_prev[i] += dy[i];
+    printf("Finished Newton iteration: %d\n", newton_iterations);
+    newton_iterations++;
+  }
+  printf("Total number of Newton iterations: %d\n", newton_iterations-1);
+
+  Linearizer l(&mesh);
+  const char *out_filename = "solution.gp";
+  l.plot_solution(out_filename, y_prev);
+
+  printf("Output written to %s.\n", out_filename);
+  printf("Done.\n");
+  return 1;
+}
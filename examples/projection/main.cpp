@@ -0,0 +1,155 @@
+#include "hermes1d.h"
+
+// ********************************************************************
+
+// This example demonstrates the projections, the transfer of solutions
+// between meshes and the error norms on the function u(x) = sin(5x):
+//   1. u is projected onto meshes with more and more elements (H1 and L2
+//      projection) and the errors are printed with their rates;
+//   2. a projection is transferred to a refined mesh and back, which is
+//      exact up to rounding;
+//   3. the problem -u'' = 25 sin(5x) with the exact solution u is solved,
+//      and its error is measured both against u and against a reference
+//      solution on a refined mesh, together with the residual-based
+//      element error indicators.
+
+// general input:
+static int NUM_EQ = 1;
+double A = 0, B = 1;                   // domain end points
+int P_INIT = 2;                        // degree of the elements
+int N_LEVELS = 6;                      // meshes with 2, 4, ... elements
+int Nelem = 6;                         // elements of the mesh in part 3
+
+// Tolerance for Newton's method
+double TOL = 1e-12;
+
+// ********************************************************************
+
+double exact_sol(double x, double *dfdx, void *user_data)
+{
+  if (dfdx != NULL) *dfdx = 5*cos(5*x);
+  return sin(5*x);
+}
+
+double jacobian(int num, double *x, double *weights,
+                double *u, double *dudx, double *v, double *dvdx,
+                double *u_prev, double *du_prevdx, void *user_data)
+{
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += dudx[i]*dvdx[i]*weights[i];
+  return val;
+};
+
+double residual_vol(int num, double *x, double *weights,
+                double *u_prev, double *du_prevdx, double *v, double *dvdx,
+                void *user_data)
+{
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += (du_prevdx[i]*dvdx[i] - 25*sin(5*x[i])*v[i])*weights[i];
+  return val;
+};
+
+void setup(DiscreteProblem *dp, void *params)
+{
+  dp->add_matrix_form(0, 0, jacobian);
+  dp->add_vector_form(0, residual_vol);
+}
+
+Mesh *create_mesh(int n_elem, bool dirichlet)
+{
+  Mesh *mesh = new Mesh(NUM_EQ);
+  mesh->create(A, B, n_elem);
+  mesh->set_poly_orders(P_INIT);
+  if (dirichlet) {
+    mesh->set_bc_left_dirichlet(0, sin(5*A));
+    mesh->set_bc_right_dirichlet(0, sin(5*B));
+  }
+  else {
+    mesh->set_bc_left_natural(0);
+    mesh->set_bc_right_natural(0);
+  }
+  mesh->assign_dofs();
+  return mesh;
+}
+
+/******************************************************************************/
+int main() {
+  ErrorNorm norm_l2(NORM_L2), norm_h1(NORM_H1);
+
+  // 1. convergence of the projections: the H1 error of the H1 projection
+  // decreases as h^p, the L2 error of the L2 projection as h^(p+1)
+  printf("Projections of sin(5x), p = %d:\n", P_INIT);
+  double err_h1_prev = 0, err_l2_prev = 0;
+  for (int l=0; l<N_LEVELS; l++) {
+    int n_elem = 2 << l;
+    Mesh *mesh = create_mesh(n_elem, false);
+    double *y = new double[mesh->get_n_dof()];
+    project_h1(mesh, exact_sol, y);
+    double err_h1 = norm_h1.calc_error(mesh, y, exact_sol);
+    project_l2(mesh, exact_sol, y);
+    double err_l2 = norm_l2.calc_error(mesh, y, exact_sol);
+    if (l == 0)
+      printf("Nelem = %3d: H1 error %.3e, L2 error %.3e\n", n_elem,
+             err_h1, err_l2);
+    else
+      printf("Nelem = %3d: H1 error %.3e (rate %.2f), L2 error %.3e "
+             "(rate %.2f)\n", n_elem, err_h1, log(err_h1_prev/err_h1)/log(2.),
+             err_l2, log(err_l2_prev/err_l2)/log(2.));
+    err_h1_prev = err_h1;
+    err_l2_prev = err_l2;
+    delete [] y;
+    delete mesh;
+  }
+
+  // 2. the refined space contains the coarse one, so the transfer there
+  // and back is exact
+  Mesh *coarse = create_mesh(Nelem, false);
+  Mesh *fine = create_refined_mesh(coarse, true, 1);
+  double *y_coarse = new double[coarse->get_n_dof()];
+  double *y_fine = new double[fine->get_n_dof()];
+  double *y_back = new double[coarse->get_n_dof()];
+  project_h1(coarse, exact_sol, y_coarse);
+  transfer_solution(coarse, y_coarse, fine, y_fine);
+  transfer_solution(fine, y_fine, coarse, y_back);
+  double diff_fine = norm_h1.calc_error(coarse, y_coarse, fine, y_fine);
+  double diff_back = 0;
+  for (int i=0; i<coarse->get_n_dof(); i++)
+    diff_back = std::max(diff_back, fabs(y_back[i] - y_coarse[i]));
+  printf("Transfer to the refined mesh: H1 difference %.3e\n", diff_fine);
+  printf("Transfer back: largest change of a coefficient %.3e\n", diff_back);
+  delete [] y_coarse;
+  delete [] y_fine;
+  delete [] y_back;
+  delete fine;
+  delete coarse;
+
+  // 3. errors of a discrete solution against the exact and a reference
+  // solution
+  Mesh *mesh = create_mesh(Nelem, true);
+  Mesh *ref_mesh = create_refined_mesh(mesh, true, 2);
+  double *y = new double[mesh->get_n_dof()];
+  double *y_ref = new double[ref_mesh->get_n_dof()];
+  if (solve_nested(1, &mesh, setup, NULL, y, TOL, 50) < 0 ||
+      solve_nested(1, &ref_mesh, setup, NULL, y_ref, TOL, 50) < 0)
+    error("Newton's method did not converge.");
+  double *elem_err = new double[Nelem];
+  double *residual_ind = new double[Nelem];
+  double err_exact = norm_h1.calc_error(mesh, y, exact_sol, NULL, elem_err);
+  double err_ref = norm_h1.calc_error(mesh, y, ref_mesh, y_ref);
+  printf("H1 error: exact %.6e, reference %.6e\n", err_exact, err_ref);
+  calc_residual_indicators(mesh, y, setup, NULL, residual_ind);
+  for (int m=0; m<Nelem; m++)
+    printf("Element %d: H1 error %.3e, residual indicator %.3e\n", m,
+           elem_err[m], residual_ind[m]);
+
+  delete [] elem_err;
+  delete [] residual_ind;
+  delete [] y;
+  delete [] y_ref;
+  delete ref_mesh;
+  delete mesh;
+  printf("Done.\n");
+  return 1;
+}
@@ -58,9 +58,11 @@ int main(int argc, char* argv[]) {
 
   // register weak forms
   DiscreteProblem dp1(NUM_EQ, &mesh);
-  dp1.add_matrix_form(0, 0, lhs);
+  // the integrands contain x*u*v and x*x*u*v, i.e., they are of
+  // degree 2p+1 and 2p+2 
+  dp1.add_matrix_form(0, 0, lhs, 1);
   DiscreteProblem dp2(NUM_EQ, &mesh);
-  dp2.add_matrix_form(0, 0, rhs);
+  dp2.add_matrix_form(0, 0, rhs, 2);
 
   // variable for the total number of DOF 
   int Ndof = mesh.get_n_dof();
@@ -73,8 +75,10 @@ int main(int argc, char* argv[]) {
   // zero initial condition for the Newton's method
   for(int i=0; i<Ndof; i++) y_prev[i] = 0; 
 
-  dp1.assemble_matrix(mat1, y_prev);
-  dp2.assemble_matrix(mat2, y_prev);
+  // assemble both matrices in one pass over the mesh
+  DiscreteProblem *dps[2] = {&dp1, &dp2};
+  Matrix *mats[2] = {mat1, mat2};
+  DiscreteProblem::assemble_multiple(2, dps, mats, NULL, y_prev);
 
   printf("Importing hermes1d\n");
   // Initialize Python
@@ -0,0 +1,103 @@
+#include "hermes1d.h"
+
+// ********************************************************************
+
+// This example solves the nonlinear diffusion problem
+//   -u'' + K*u^3 = F,  u(0) = u(1) = 0
+// by mesh sequencing: Newton's method runs on a coarse mesh first, and its
+// solution, transferred to the next finer mesh, is the initial guess
+// there. The meshes are obtained by bisecting all elements and raising
+// their degrees. For comparison, the problem is also solved on the finest
+// mesh directly, starting from zero.
+
+// general input:
+static int NUM_EQ = 1;
+int Nelem = 4;                         // elements of the coarsest mesh
+double A = 0, B = 1;                   // domain end points
+int P_INIT = 2;                        // degree on the coarsest mesh
+int N_LEVELS = 5;                      // number of meshes
+
+// nonlinearity and source
+double K = 1000, F = 1000;
+
+// Tolerance for Newton's method
+double TOL = 1e-10;
+
+// ********************************************************************
+
+double jacobian(int num, double *x, double *weights, 
+                double *u, double *dudx, double *v, double *dvdx, 
+                double *u_prev, double *du_prevdx, void *user_data)
+{
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += (dudx[i]*dvdx[i] + 3*K*u_prev[i]*u_prev[i]*u[i]*v[i])*weights[i];
+  return val;
+};
+
+double residual_vol(int num, double *x, double *weights, 
+                double *u_prev, double *du_prevdx, double *v, double *dvdx,
+                void *user_data)
+{
+  double val = 0;
+  for(int i = 0; i<num; i++)
+    val += (du_prevdx[i]*dvdx[i]
+            + (K*u_prev[i]*u_prev[i]*u_prev[i] - F)*v[i])*weights[i];
+  return val;
+};
+
+void setup(DiscreteProblem *dp, void *params)
+{
+  dp->add_matrix_form(0, 0, jacobian);
+  dp->add_vector_form(0, residual_vol);
+}
+
+/******************************************************************************/
+int main() {
+  // the coarsest mesh
+  Mesh *meshes[N_LEVELS];
+  meshes[0] = new Mesh(NUM_EQ);
+  meshes[0]->create(A, B, Nelem);
+  meshes[0]->set_poly_orders(P_INIT);
+  meshes[0]->set_bc_left_dirichlet(0, 0);
+  meshes[0]->set_bc_right_dirichlet(0, 0);
+  meshes[0]->assign_dofs();
+  // the finer ones
+  for (int l=1; l<N_LEVELS; l++)
+    meshes[l] = create_refined_mesh(meshes[l-1], true, 1);
+
+  Mesh *fine = meshes[N_LEVELS-1];
+  int Ndof = fine->get_n_dof();
+  printf("Ndof = %d\n", Ndof);
+  double *y = new double[Ndof];
+  int iterations[N_LEVELS];
+  int total = solve_nested(N_LEVELS, meshes, setup, NULL, y, TOL, 50,
+                           iterations);
+  if (total < 0) error("Mesh sequencing did not converge.");
+  for (int l=0; l<N_LEVELS; l++)
+    printf("Level %d: Ndof = %d, Newton iterations: %d\n", l,
+           meshes[l]->get_n_dof(), iterations[l]);
+
+  // the finest mesh alone
+  double *y_direct = new double[Ndof];
+  int direct = solve_nested(1, &fine, setup, NULL, y_direct, TOL, 50);
+  if (direct < 0)
+    printf("Newton's method on the finest mesh alone did not converge.\n");
+  else {
+    double diff = 0;
+    for (int i=0; i<Ndof; i++)
+      diff = std::max(diff, fabs(y[i] - y_direct[i]));
+    printf("Finest mesh alone: Newton iterations: %d, difference: %g\n",
+           direct, diff);
+  }
+
+  Linearizer l(fine);
+  l.plot_solution("solution.gp", y);
+  printf("Output written to solution.gp.\n");
+
+  for (int l=0; l<N_LEVELS; l++) delete meshes[l];
+  delete [] y;
+  delete [] y_direct;
+  printf("Done.\n");
+  return 1;
+}
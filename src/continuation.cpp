@@ -0,0 +1,167 @@
+#include "continuation.h"
+
+Continuation::Continuation(DiscreteProblem *dp, double *lambda, double tol,
+        int max_iter) : solver(dp)
+{
+  this->dp = dp;
+  this->lambda = lambda;
+  this->tol = tol;
+  this->max_iter = max_iter;
+  this->target_iter = 3;
+  this->h = 0.1;
+  this->h_min = 1e-6;
+  this->h_max = 1;
+  this->arclength = false;
+  this->n_dof = dp->get_mesh()->get_n_dof();
+  this->y0 = new double[this->n_dof];
+  this->y1 = new double[this->n_dof];
+  this->dy = new double[this->n_dof];
+  this->dy2 = new double[this->n_dof];
+  this->t_y = new double[this->n_dof];
+  this->lambda0 = this->lambda1 = 0;
+  this->n_points = 0;
+}
+
+Continuation::~Continuation()
+{
+  delete [] this->y0;
+  delete [] this->y1;
+  delete [] this->dy;
+  delete [] this->dy2;
+  delete [] this->t_y;
+}
+
+void Continuation::set_step(double h, double h_min, double h_max)
+{
+  this->h = h;
+  this->h_min = h_min;
+  this->h_max = h_max;
+}
+
+// Newton's method at the current value of *lambda; returns the number of
+// iterations or -1
+int Continuation::newton(double *y)
+{
+  for (int it=0; it<=this->max_iter; it++) {
+    double res_norm = this->solver.solve(y, this->dy);
+    if (res_norm < this->tol) return it;
+    if (!(res_norm < 1e100)) return -1;  // diverged
+    for (int i=0; i<this->n_dof; i++) y[i] += this->dy[i];
+  }
+  return -1;
+}
+
+// Newton's method for the residual together with the arclength condition
+//   t_y.(y - y1) + t_l*(lam - lambda1) = ds,
+// solved by bordering: with a = -J^{-1} res and b = -J^{-1} d(res)/d(lam),
+// the update is dy = a + dlam*b. Returns the number of iterations or -1.
+int Continuation::newton_arclength(double *y, double *lam, double *t_y,
+        double t_l, double ds)
+{
+  int n = this->n_dof;
+  for (int it=0; it<=this->max_iter; it++) {
+    *this->lambda = *lam;
+    double res_norm = this->solver.solve(y, this->dy);
+    double cond = t_l*(*lam - this->lambda1) - ds;
+    for (int i=0; i<n; i++) cond += t_y[i]*(y[i] - this->y1[i]);
+    if (res_norm < this->tol && fabs(cond) < this->tol) return it;
+    if (!(res_norm < 1e100)) return -1;
+
+    // b from the update at a perturbed lambda
+    double delta = 1e-7*std::max(1., fabs(*lam));
+    *this->lambda = *lam + delta;
+    this->solver.solve(y, this->dy2);
+    double t_a = 0, t_b = 0;
+    for (int i=0; i<n; i++) {
+      this->dy2[i] = (this->dy2[i] - this->dy[i]) / delta;
+      t_a += t_y[i]*this->dy[i];
+      t_b += t_y[i]*this->dy2[i];
+    }
+    if (t_b + t_l == 0) return -1;
+    double dlam = (-cond - t_a) / (t_b + t_l);
+    for (int i=0; i<n; i++) y[i] += this->dy[i] + dlam*this->dy2[i];
+    *lam += dlam;
+  }
+  return -1;
+}
+
+int Continuation::start(double lambda0, double *y)
+{
+  *this->lambda = lambda0;
+  int it = this->newton(y);
+  if (it < 0) return -1;
+  for (int i=0; i<this->n_dof; i++) this->y1[i] = y[i];
+  this->lambda1 = lambda0;
+  this->n_points = 1;
+  return it;
+}
+
+int Continuation::step(double *y)
+{
+  if (this->n_points == 0) error("Continuation: start() was not called.");
+  int n = this->n_dof;
+  bool arclength = this->arclength && this->n_points >= 2;
+
+  // unit secant of the last two points, for the arclength mode
+  double *t_y = this->t_y, t_l = 0;
+  if (arclength) {
+    double norm = 0;
+    for (int i=0; i<n; i++) {
+      t_y[i] = this->y1[i] - this->y0[i];
+      norm += t_y[i]*t_y[i];
+    }
+    t_l = this->lambda1 - this->lambda0;
+    norm = sqrt(norm + t_l*t_l);
+    if (norm == 0) error("Continuation: the last two points coincide.");
+    for (int i=0; i<n; i++) t_y[i] /= norm;
+    t_l /= norm;
+  }
+
+  while (1) {
+    double lam;
+    int it;
+    if (arclength) {
+      // predictor along the secant, ds = |h|
+      double ds = fabs(this->h);
+      for (int i=0; i<n; i++) y[i] = this->y1[i] + ds*t_y[i];
+      lam = this->lambda1 + ds*t_l;
+      it = this->newton_arclength(y, &lam, t_y, t_l, ds);
+    }
+    else {
+      // secant predictor in lambda (the last solution for the first step)
+      lam = this->lambda1 + this->h;
+      double s = this->n_points >= 2 ?
+                 this->h / (this->lambda1 - this->lambda0) : 0;
+      for (int i=0; i<n; i++)
+        y[i] = this->y1[i] + s*(this->y1[i] - this->y0[i]);
+      *this->lambda = lam;
+      it = this->newton(y);
+    }
+
+    if (it >= 0) {
+      // accept the point and adapt the step size
+      for (int i=0; i<n; i++) {
+        this->y0[i] = this->y1[i];
+        this->y1[i] = y[i];
+      }
+      this->lambda0 = this->lambda1;
+      this->lambda1 = lam;
+      *this->lambda = lam;
+      this->n_points++;
+      double scale = 1;
+      if (it < this->target_iter) scale = 1.5;
+      else if (it > this->target_iter) scale = 0.7;
+      double h_abs = std::min(fabs(this->h)*scale, this->h_max);
+      this->h = this->h < 0 ? -h_abs : h_abs;
+      return it;
+    }
+
+    // repeat with half the step
+    this->h /= 2;
+    if (fabs(this->h) < this->h_min) {
+      for (int i=0; i<n; i++) y[i] = this->y1[i];
+      *this->lambda = this->lambda1;
+      return -1;
+    }
+  }
+}
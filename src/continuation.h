@@ -0,0 +1,86 @@
+#ifndef _CONTINUATION_H_
+#define _CONTINUATION_H_
+
+#include "discrete.h"
+#include "frontal.h"
+
+/// \brief Continuation of the solution along a parameter.
+///
+/// The forms of the problem depend on a parameter lambda, which they read
+/// from the variable '*lambda' (e.g. through their user_data); the driver
+/// sets it before every assembly. Every new point starts from a prediction
+/// extrapolated from the last two points (the previous solution for the
+/// first step) and is corrected by Newton's method with a FrontalSolver.
+/// The step size is adapted to the number of Newton iterations: it grows
+/// when fewer than the target number were needed, shrinks when more were
+/// needed, and is halved and the step repeated when Newton's method fails.
+///
+/// In the natural mode, the step is taken in lambda. In the pseudo-arclength
+/// mode, the step is the length along the secant of the solution curve in
+/// the (y, lambda) space, and lambda is an unknown of the corrector, so the
+/// curve can be followed around turning points where lambda reverses. The
+/// derivative of the residual with respect to lambda is approximated by a
+/// difference quotient of two Newton updates, so each corrector iteration
+/// costs two frontal solves.
+///
+/// Forms depending on lambda must not be registered as linear forms, and
+/// coefficient functions depending on it must be registered as solution
+/// dependent, since the cached values would not follow lambda.
+class Continuation {
+public:
+    Continuation(DiscreteProblem *dp, double *lambda, double tol=1e-8,
+                 int max_iter=20);
+    ~Continuation();
+
+    /// Initial step size, and bounds for its magnitude. A negative step
+    /// continues towards decreasing lambda; in the arclength mode, the
+    /// direction is that of the last two points.
+    void set_step(double h, double h_min, double h_max);
+    /// Number of Newton iterations the step adaptation aims at.
+    void set_target_iterations(int n) {
+        this->target_iter = n;
+    }
+    /// Switches to the pseudo-arclength mode (which starts after the
+    /// second point).
+    void set_arclength(bool arclength) {
+        this->arclength = arclength;
+    }
+
+    /// Solves the problem at lambda0 starting from 'y' and makes it the
+    /// first point. Returns the number of Newton iterations, or -1 if
+    /// Newton's method did not converge.
+    int start(double lambda0, double *y);
+    /// Computes the next point; on return 'y' and get_lambda() hold it.
+    /// Returns the number of Newton iterations of the accepted step, or -1
+    /// if no step larger than the minimum step size converged (then 'y'
+    /// and lambda are those of the last point).
+    int step(double *y);
+
+    double get_lambda() {
+        return this->lambda1;
+    }
+    double get_step() {
+        return this->h;
+    }
+
+private:
+    DiscreteProblem *dp;
+    FrontalSolver solver;
+    double *lambda;
+    double tol;
+    int max_iter, target_iter;
+    double h, h_min, h_max;
+    bool arclength;
+
+    int n_dof;
+    // the last two points (y1, lambda1) and (y0, lambda0)
+    double *y0, *y1, lambda0, lambda1;
+    int n_points;
+    double *dy, *dy2, *t_y;
+
+    int newton(double *y);
+    int newton_arclength(double *y, double *lam, double *t_y, double t_l,
+                         double ds);
+};
+
+#endif
@@ -1,33 +1,190 @@
+#include <stdint.h>
+#include <algorithm>
+
 #include "discrete.h"
 
+// parts of the volumetric forms evaluated by DiscreteProblem::eval_vol_forms()
+#define FORMS_ALL 0
+#define FORMS_LINEAR 1
+#define FORMS_NONLINEAR 2
+
 DiscreteProblem::DiscreteProblem(int neq, Mesh *mesh)
 {
     this->neq = neq;
     this->mesh = mesh;
+    this->geom_cache = NULL;
+    this->linear_revision = -1;
+    this->inc_revision = -1;
+    this->coeff_revision = -1;
+    this->reset_incremental();
 }
 
-void DiscreteProblem::add_matrix_form(int i, int j, matrix_form fn)
+void DiscreteProblem::add_matrix_form(int i, int j, matrix_form fn,
+        int order_offset, int order_p_mult, void *user_data)
 {
-    MatrixFormVol form = {i, j, fn};
+    MatrixFormVol form = {i, j, fn, order_offset, order_p_mult, false,
+                          user_data};
     this->matrix_forms_vol.push_back(form);
+    this->reset_incremental();
 }
 
-void DiscreteProblem::add_vector_form(int i, vector_form fn)
+void DiscreteProblem::add_matrix_form_linear(int i, int j, matrix_form fn,
+        int order_offset, int order_p_mult, void *user_data)
 {
-    VectorFormVol form = {i, fn};
+    MatrixFormVol form = {i, j, fn, order_offset, order_p_mult, true,
+                          user_data};
+    this->matrix_forms_vol.push_back(form);
+    this->linear_revision = -1;
+    this->reset_incremental();
+}
+
+void DiscreteProblem::add_vector_form(int i, vector_form fn,
+        int order_offset, int order_p_mult, void *user_data)
+{
+    VectorFormVol form = {i, fn, order_offset, order_p_mult, user_data};
     this->vector_forms_vol.push_back(form);
+    this->reset_incremental();
+}
+
+void DiscreteProblem::add_vector_form_all(int i, vector_form_all fn,
+        int order_offset, int order_p_mult, void *user_data)
+{
+    VectorFormVolAll form = {i, fn, order_offset, order_p_mult, user_data};
+    this->vector_forms_vol_all.push_back(form);
+    this->reset_incremental();
+}
+
+void DiscreteProblem::add_matrix_form_batch(int i, int j,
+        matrix_form_batch fn, int order_offset, int order_p_mult,
+        void *user_data)
+{
+    MatrixFormVolBatch form = {i, j, fn, order_offset, order_p_mult,
+                               user_data};
+    this->matrix_forms_vol_batch.push_back(form);
+    this->reset_incremental();
+}
+
+void DiscreteProblem::add_vector_form_batch(int i, vector_form_batch fn,
+        int order_offset, int order_p_mult, void *user_data)
+{
+    VectorFormVolBatch form = {i, fn, order_offset, order_p_mult, user_data};
+    this->vector_forms_vol_batch.push_back(form);
+    this->reset_incremental();
+}
+
+void DiscreteProblem::add_matrix_form_const(int i, int j, int type, double c)
+{
+    if (type < FORM_STIFFNESS || type > FORM_ADVECTION)
+        error("Unknown type of constant-coefficient form.");
+    FormConst form = {i, j, type, c};
+    this->matrix_forms_const.push_back(form);
+    this->linear_revision = -1;
+    this->reset_incremental();
 }
 
-void DiscreteProblem::add_matrix_form_surf(int i, int j, matrix_form_surf fn, int bdy_index)
+void DiscreteProblem::add_vector_form_const(int i, int type, double c)
 {
-    MatrixFormSurf form = {i, j, bdy_index, fn};
+    if (type < FORM_STIFFNESS || type > FORM_ADVECTION)
+        error("Unknown type of constant-coefficient form.");
+    FormConst form = {i, 0, type, c};
+    this->vector_forms_const.push_back(form);
+    this->reset_incremental();
+}
+
+int DiscreteProblem::add_coeff(coeff_fn fn, bool depends_on_solution)
+{
+    if (this->coeffs.size() >= MAX_COEFFS)
+        error("Too many coefficient functions.");
+    CoeffFn c = {fn, depends_on_solution};
+    this->coeffs.push_back(c);
+    this->coeff_cache.clear();
+    this->coeff_revision = -1;
+    this->linear_revision = -1;
+    this->reset_incremental();
+    return this->coeffs.size() - 1;
+}
+
+FormCoeffs *DiscreteProblem::eval_coeffs(int m, int order, int num,
+        double *x, double *u_prev, double *du_prevdx, double *buf,
+        FormCoeffs *fc)
+{
+    int n = this->coeffs.size();
+    if (n == 0) return NULL;
+    int pad = quad_padded(num);
+    // the solution-independent coefficients of all elements are evaluated
+    // once per mesh revision and quadrature order (the problem is used by
+    // one thread only, see the class documentation)
+    if (this->coeff_revision != this->mesh->get_revision() ||
+        !this->coeff_cache[order].done)
+        this->update_coeff_cache(order);
+    double *cached = &this->coeff_cache[order].val[(size_t) m*n*num];
+    fc->n = n;
+    for (int c=0; c<n; c++) {
+        double *val = buf + c*pad;
+        if (this->coeffs[c].depends_on_solution)
+            this->coeffs[c].fn(num, x, u_prev, du_prevdx, val);
+        else {
+            for (int k=0; k<num; k++) val[k] = cached[c*num + k];
+        }
+        for (int k=num; k<pad; k++) val[k] = 0;
+        fc->val[c] = val;
+    }
+    return fc;
+}
+
+// evaluates the solution-independent coefficients of all elements for
+// the given quadrature order, unless this has been done for the current
+// mesh revision already
+void DiscreteProblem::update_coeff_cache(int order)
+{
+    if (this->coeff_revision != this->mesh->get_revision()) {
+        this->coeff_cache.clear();
+        this->coeff_cache.resize(g_quad_1d_std.get_max_order() + 1);
+        this->coeff_revision = this->mesh->get_revision();
+    }
+    CoeffCache &cache = this->coeff_cache[order];
+    if (cache.done) return;
+    int n = this->coeffs.size();
+    int n_elem = this->mesh->get_n_elems();
+    Element *elems = this->mesh->get_elems();
+    int num = g_quad_1d_std.get_num_points(order);
+    double x[QUAD_MAX_PTS], w[QUAD_MAX_PTS];
+    cache.val.assign((size_t) n_elem*n*num, 0.);
+    for (int m=0; m<n_elem; m++) {
+        element_quadrature(elems[m].v1->x, elems[m].v2->x, order, x, w, &num);
+        double *cached = &cache.val[(size_t) m*n*num];
+        for (int c=0; c<n; c++)
+            if (!this->coeffs[c].depends_on_solution)
+                this->coeffs[c].fn(num, x, NULL, NULL, cached + c*num);
+    }
+    cache.done = true;
+}
+
+bool DiscreteProblem::use_batch_forms()
+{
+    if (this->matrix_forms_vol_batch.empty() &&
+        this->vector_forms_vol_batch.empty()) return false;
+    if (!this->matrix_forms_vol.empty() || !this->vector_forms_vol.empty() ||
+        !this->vector_forms_vol_all.empty() || !this->coeffs.empty())
+        error("Batched forms cannot be combined with other volumetric forms "
+              "or coefficient functions.");
+    return true;
+}
+
+void DiscreteProblem::add_matrix_form_surf(int i, int j, matrix_form_surf fn, int bdy_index,
+        void *user_data)
+{
+    MatrixFormSurf form = {i, j, bdy_index, fn, user_data};
     this->matrix_forms_surf.push_back(form);
+    this->reset_incremental();
 }
 
-void DiscreteProblem::add_vector_form_surf(int i, vector_form_surf fn, int bdy_index)
+void DiscreteProblem::add_vector_form_surf(int i, vector_form_surf fn, int bdy_index,
+        void *user_data)
 {
-    VectorFormSurf form = {i, bdy_index, fn};
+    VectorFormSurf form = {i, bdy_index, fn, user_data};
     this->vector_forms_surf.push_back(form);
+    this->reset_incremental();
 }
 
 
@@ -51,163 +208,1087 @@ void calculate_elem_coeffs(Mesh *mesh, int m, double *y_prev, double *coeffs)
     }
 }
 
-// process volumetric weak forms
-void DiscreteProblem::process_vol_forms(Matrix *mat, double *res, 
-              double *y_prev, int matrix_flag) {
+// Reference data of the degree-P element kernel: the Gauss points and
+// weights of order 2P (P+1 points) and the values and derivatives of the
+// shape functions 0..P at these points, padded as described in
+// form_utils.h. Computed once on first use.
+template<int P>
+struct KernelBasis {
+  enum { NPP = (P + QUAD_PAD) / QUAD_PAD * QUAD_PAD };
+  double pts[NPP] QUAD_ALIGNED;
+  double weights[NPP] QUAD_ALIGNED;
+  double val[P+1][NPP] QUAD_ALIGNED;
+  double der[P+1][NPP] QUAD_ALIGNED;
+
+  KernelBasis() {
+    int order = 2*P;
+    if (g_quad_1d_std.get_num_points(order) != P+1)
+      error("Unexpected number of quadrature points.");
+    double2 *ref_tab = g_quad_1d_std.get_points(order);
+    for (int k=0; k<NPP; k++) {
+      pts[k] = ref_tab[k <= P ? k : P][0];
+      weights[k] = k <= P ? ref_tab[k][1] : 0;
+    }
+    lobatto_eval(P, NPP, pts, val[0], der[0]);
+    for (int j=0; j<=P; j++)
+      for (int k=P+1; k<NPP; k++) val[j][k] = der[j][k] = 0;
+  }
+};
+
+template<int P>
+static const KernelBasis<P> &kernel_basis()
+{
+  static KernelBasis<P> basis;
+  return basis;
+}
+
+// Reference matrix of the given form type for degree p on (-1, 1),
+// R[j*(p+1) + i] = a(phi_j, phi_i) (phi_j... basis, phi_i... test
+// function), computed once on first use. The Gauss rule of order 2p
+// integrates all three types exactly. The tables are shared by all
+// threads: a table is created inside a critical section and published with
+// an atomic write after a flush, and read with an atomic read followed by a
+// flush, so the critical section is only entered when a table is missing.
+#define REF_MAX_P 49   // 2p must not exceed the highest quadrature order
+
+static const double *reference_matrix(int type, int p)
+{
+  static double *tabs[3][REF_MAX_P+1];
+  if (p > REF_MAX_P) error("Polynomial degree too high.");
+  double *tab;
+  #pragma omp atomic read
+  tab = tabs[type][p];
+  #pragma omp flush
+  if (tab != NULL) return tab;
+  #pragma omp critical (hermes1d_reference_matrix)
+  {
+    tab = tabs[type][p];
+    if (tab == NULL) {
+      int n = p + 1;
+      int order = 2*p;
+      double2 *ref_tab = g_quad_1d_std.get_points(order);
+      int np = g_quad_1d_std.get_num_points(order);
+      double pts[np];
+      for (int k=0; k<np; k++) pts[k] = ref_tab[k][0];
+      double val[n*np], der[n*np];
+      lobatto_eval(p, np, pts, val, der);
+      double *u = type == FORM_MASS ? val : der;
+      double *v = type == FORM_STIFFNESS ? der : val;
+      double *m = new double[n*n];
+      for (int j=0; j<n; j++)
+        for (int i=0; i<n; i++) {
+          double sum = 0;
+          for (int k=0; k<np; k++)
+            sum += u[j*np + k]*v[i*np + k]*ref_tab[k][1];
+          m[j*n + i] = sum;
+        }
+      #pragma omp flush
+      #pragma omp atomic write
+      tabs[type][p] = m;
+      tab = m;
+    }
+  }
+  return tab;
+}
+
+// add the constant-coefficient forms to the local matrix and vector of
+// element 'e' with the solution coefficients 'coeffs'
+void DiscreteProblem::add_const_forms(Element *e, double *coeffs,
+        double *local_mat, double *local_res, bool do_mat, bool do_res)
+{
+  int n_loc = e->p + 1;
+  double jac = (e->v2->x - e->v1->x)/2.;
+  // d/dx = 1/jac d/dxi, dx = jac dxi
+  double scale[3] = {1./jac, jac, 1.};
+  if (do_mat) {
+    for (unsigned f=0; f<this->matrix_forms_const.size(); f++) {
+      FormConst &form = this->matrix_forms_const[f];
+      const double *r = reference_matrix(form.type, e->p);
+      double c = form.c*scale[form.type];
+      for (int j=0; j<n_loc; j++) {
+        if (e->dof[j] == -1) continue;
+        for (int i=0; i<n_loc; i++)
+          if (e->dof[i] != -1) local_mat[j*n_loc + i] += c*r[j*n_loc + i];
+      }
+    }
+  }
+  if (do_res) {
+    for (unsigned f=0; f<this->vector_forms_const.size(); f++) {
+      FormConst &form = this->vector_forms_const[f];
+      const double *r = reference_matrix(form.type, e->p);
+      double c = form.c*scale[form.type];
+      for (int i=0; i<n_loc; i++) {
+        if (e->dof[i] == -1) continue;
+        double sum = 0;
+        for (int j=0; j<n_loc; j++) sum += r[j*n_loc + i]*coeffs[j];
+        local_res[i] += c*sum;
+      }
+    }
+  }
+}
+
+// user_data of a volumetric form registered with the pointer 'data': the
+// coefficient values 'fc' if there are coefficient functions, the pointer
+// itself otherwise
+static inline void *form_user_data(FormCoeffs *fc, void *data)
+{
+  if (fc == NULL) return data;
+  fc->user_data = data;
+  return fc;
+}
+
+// quadrature order of a form with the given order hint in an element of
+// degree p
+static int form_quad_order(int p, int order_p_mult, int order_offset)
+{
+  int order = order_p_mult*p + order_offset;
+  if (order < 0) order = 0;
+  if (order > g_quad_1d_std.get_max_order())
+    error("Quadrature order is too high.");
+  return order;
+}
+
+// Quadrature data of element 'e' for the given order: points, weights,
+// previous solution and the shape functions transformed to the element,
+// padded as described in form_utils.h (the shape functions are stored
+// row-wise with the padded length). If 'geometry' is false, x and w are
+// already set and the inverse Jacobian is given. Returns the number of
+// points.
+static int element_quad_data(Element *e, double *coeffs, int order,
+        bool geometry, double inv_jac, double *x, double *w, double *u_prev,
+        double *du_prevdx, double *val, double *der)
+{
+  int n_loc = e->p + 1;
+  int pts_num = g_quad_1d_std.get_num_points(order);
+  int pts_pad = quad_padded(pts_num);
+  if (geometry) {
+    element_quadrature(e->v1->x, e->v2->x, order, x, w, &pts_num);
+    for (int k=pts_num; k<pts_pad; k++) {
+      x[k] = x[pts_num-1];
+      w[k] = 0;
+    }
+    inv_jac = 2./(e->v2->x - e->v1->x);
+  }
+  double2 *ref_tab = g_quad_1d_std.get_points(order);
+  double pts_array[pts_pad];
+  for (int k=0; k<pts_pad; k++)
+    pts_array[k] = ref_tab[k < pts_num ? k : pts_num-1][0];
+  lobatto_eval(e->p, pts_pad, pts_array, val, der);
+  for (int k=0; k<n_loc*pts_pad; k++) der[k] *= inv_jac;
+  for (int k=0; k<pts_pad; k++) {
+    u_prev[k] = du_prevdx[k] = 0;
+    for (int j=0; j<n_loc; j++) {
+      u_prev[k] += coeffs[j]*val[j*pts_pad + k];
+      du_prevdx[k] += coeffs[j]*der[j*pts_pad + k];
+    }
+  }
+  // zero the padding
+  for (int k=pts_num; k<pts_pad; k++) {
+    u_prev[k] = du_prevdx[k] = 0;
+    for (int j=0; j<n_loc; j++) val[j*pts_pad + k] = der[j*pts_pad + k] = 0;
+  }
+  return pts_num;
+}
+
+//// GeometryCache /////////////////////////////////////////////////////////////
+
+GeometryCache::GeometryCache(Mesh *mesh, size_t max_bytes)
+{
+  this->mesh = mesh;
+  this->max_bytes = max_bytes;
+  this->size = 0;
+  this->inv_jac = NULL;
+  this->revision = -1;
+}
+
+GeometryCache::~GeometryCache()
+{
+  this->clear();
+}
+
+void GeometryCache::clear()
+{
+  for (unsigned k=0; k<this->raw.size(); k++) delete [] this->raw[k];
+  this->raw.clear();
+  this->data.clear();
+  this->failed.clear();
+  delete [] this->inv_jac;
+  this->inv_jac = NULL;
+  this->size = 0;
+  this->revision = -1;
+}
+
+// The cache may be shared by several threads (see EnsembleSolver), so the
+// data is created inside a critical section; once created, it is only read.
+// The revision and the pointers of the orders are published as in
+// reference_matrix(): a flush and an atomic write by the creating thread,
+// an atomic read and a flush by the others.
+void GeometryCache::update()
+{
+  int rev;
+  #pragma omp atomic read
+  rev = this->revision;
+  #pragma omp flush
+  if (rev == this->mesh->get_revision()) return;
+  #pragma omp critical (hermes1d_geometry_cache)
+  if (this->revision != this->mesh->get_revision()) {
+    this->clear();
+    int n_elem = this->mesh->get_n_elems();
+    Element *elems = this->mesh->get_elems();
+    this->inv_jac = new double[n_elem];
+    for (int m=0; m<n_elem; m++)
+      this->inv_jac[m] = 2./(elems[m].v2->x - elems[m].v1->x);
+    this->size = n_elem*sizeof(double);
+    int n_orders = g_quad_1d_std.get_max_order() + 1;
+    this->raw.assign(n_orders, (double *) NULL);
+    this->data.assign(n_orders, (double *) NULL);
+    this->failed.assign(n_orders, false);
+    #pragma omp flush
+    #pragma omp atomic write
+    this->revision = this->mesh->get_revision();
+  }
+}
+
+// computes the points and weights of 'order' for all elements unless they
+// exist already; returns false if they do not fit into the memory budget
+bool GeometryCache::add_order(int order)
+{
+  if (this->data[order] != NULL) return true;
+  if (this->failed[order]) return false;
+  int pad = quad_padded(g_quad_1d_std.get_num_points(order));
+  int n_elem = this->mesh->get_n_elems();
+  size_t n = 2*(size_t) n_elem*pad;
+  if (this->size + n*sizeof(double) > this->max_bytes) {
+    this->failed[order] = true;
+    return false;
+  }
+  double *r = new double[n + QUAD_ALIGN/sizeof(double)];
+  double *d = (double *) (((uintptr_t) r + QUAD_ALIGN - 1) &
+                          ~(uintptr_t) (QUAD_ALIGN - 1));
   Element *elems = this->mesh->get_elems();
-  for(int m=0; m < this->mesh->get_n_elems(); m++) {
-    // to store quadrature data
-    int    pts_num = 0;       // num of quad points
-    double phys_pts[100];     // quad points
-    double phys_weights[100]; // quad weights
-    double phys_u[100];
-    double phys_dudx[100];
-    double phys_v[100];
-    double phys_dvdx[100];
-    double phys_u_prev[100];
-    double phys_du_prevdx[100];
-    // decide quadrature order and set up 
-    // quadrature weights and points in element m
-    int order = 2*elems[m].p; // FIXME - this needs to be improved.
-    element_quadrature(elems[m].v1->x, elems[m].v2->x,  
-	               order, phys_pts, phys_weights, &pts_num); 
-
-    // evaluate previous solution and its derivative 
-    // at all quadrature points in the element
-    double coeffs[100];
+  for (int e=0; e<n_elem; e++) {
+    double *xe = d + 2*(size_t) e*pad, *we = xe + pad;
+    int num;
+    element_quadrature(elems[e].v1->x, elems[e].v2->x, order, xe, we, &num);
+    for (int k=num; k<pad; k++) {
+      xe[k] = xe[num-1];
+      we[k] = 0;
+    }
+  }
+  this->raw[order] = r;
+  this->size += n*sizeof(double);
+  double **slot = &this->data[order];
+  #pragma omp flush
+  #pragma omp atomic write
+  *slot = d;
+  return true;
+}
+
+int GeometryCache::get_quadrature(int m, int order, double **x, double **w)
+{
+  this->update();
+  int pts_num = g_quad_1d_std.get_num_points(order);
+  int pad = quad_padded(pts_num);
+  double **slot = &this->data[order];
+  double *d;
+  #pragma omp atomic read
+  d = *slot;
+  #pragma omp flush
+  if (d == NULL) {
+    bool ok;
+    #pragma omp critical (hermes1d_geometry_cache)
+    {
+      ok = this->add_order(order);
+      d = *slot;
+    }
+    if (!ok) return -1;
+  }
+  *x = d + 2*(size_t) m*pad;
+  *w = *x + pad;
+  return pts_num;
+}
+
+double GeometryCache::get_inv_jac(int m)
+{
+  this->update();
+  return this->inv_jac[m];
+}
+
+// Quadrature data of one element for a few quadrature orders, shared by all
+// forms evaluated in the element (and, in assemble_multiple(), by all
+// problems). The buffers are reused from one element to the next.
+#define QUAD_CACHE_SLOTS 4
+
+class ElementQuadCache {
+public:
+  struct Data {
+    int order, pts_num;
+    double *x, *w, *u_prev, *du_prevdx, *val, *der;
+  };
+
+  // 'shared' marks a cache shared by several problems (assemble_multiple()),
+  // which then also feeds the element kernels
+  ElementQuadCache(bool shared=false) {
+    this->shared = shared;
+    this->e = NULL;
+    this->m = -1;
+    this->geom = NULL;
+    this->y_prev = NULL;
+    this->n_used = 0;
+    this->next = 0;
+    for (int k=0; k<QUAD_CACHE_SLOTS; k++) {
+      this->buf[k] = NULL;
+      this->cap[k] = 0;
+    }
+  }
+  ~ElementQuadCache() {
+    for (int k=0; k<QUAD_CACHE_SLOTS; k++) delete [] this->buf[k];
+  }
+
+  // switch to element 'e' (with index 'm' in the mesh and the geometry
+  // cache 'geom', which may be NULL) with the solution coefficients
+  // 'coeffs' of 'y_prev', unless it is the current one
+  void set_element(Element *e, int m, GeometryCache *geom, double *y_prev,
+                   double *coeffs) {
+    if (e == this->e && y_prev == this->y_prev) return;
+    this->e = e;
+    this->m = m;
+    this->geom = geom;
+    this->y_prev = y_prev;
+    for (int j=0; j<=e->p; j++) this->coeffs[j] = coeffs[j];
+    this->n_used = 0;
+  }
+
+  bool is_shared() {
+    return this->shared;
+  }
+
+  Data *get(int order) {
+    for (int k=0; k<this->n_used; k++)
+      if (this->data[k].order == order) return this->data + k;
+    int k = this->n_used < QUAD_CACHE_SLOTS ? this->n_used++ :
+            this->next++ % QUAD_CACHE_SLOTS;
+    int pad = quad_padded(g_quad_1d_std.get_num_points(order));
+    int n = (4 + 2*(this->e->p + 1))*pad;
+    if (this->cap[k] < n) {
+      delete [] this->buf[k];
+      this->buf[k] = new double[n + QUAD_ALIGN/sizeof(double)];
+      this->cap[k] = n;
+    }
+    // all arrays have a multiple of QUAD_PAD entries, so they stay aligned
+    double *p = (double *) (((uintptr_t) this->buf[k] + QUAD_ALIGN - 1) &
+                            ~(uintptr_t) (QUAD_ALIGN - 1));
+    Data *d = this->data + k;
+    d->order = order;
+    d->x = p;
+    d->w = p + pad;
+    d->u_prev = p + 2*pad;
+    d->du_prevdx = p + 3*pad;
+    d->val = p + 4*pad;
+    d->der = d->val + (this->e->p + 1)*pad;
+    // take the points and weights from the geometry cache if possible
+    bool geometry = (this->geom == NULL ||
+                     this->geom->get_quadrature(this->m, order, &d->x,
+                                                &d->w) < 0);
+    double inv_jac = geometry ? 0 : this->geom->get_inv_jac(this->m);
+    d->pts_num = element_quad_data(this->e, this->coeffs, order, geometry,
+                                   inv_jac, d->x, d->w, d->u_prev,
+                                   d->du_prevdx, d->val, d->der);
+    return d;
+  }
+
+private:
+  bool shared;
+  Element *e;
+  int m;
+  GeometryCache *geom;
+  double *y_prev;
+  double coeffs[100];
+  Data data[QUAD_CACHE_SLOTS];
+  double *buf[QUAD_CACHE_SLOTS];
+  int cap[QUAD_CACHE_SLOTS];
+  int n_used, next;
+};
+
+// Values of the coefficient functions of a problem in one element for the
+// quadrature orders used there (the ElementQuadCache may be shared by
+// several problems, so they are kept separately).
+class ElementCoeffs {
+public:
+  ElementCoeffs(DiscreteProblem *dp, int m) {
+    this->dp = dp;
+    this->m = m;
+    this->n_used = 0;
+    this->next = 0;
+  }
+
+  // coefficient values for the quadrature data 'd', NULL if there are no
+  // coefficient functions
+  FormCoeffs *get(ElementQuadCache::Data *d) {
+    if (this->dp->get_n_coeffs() == 0) return NULL;
+    for (int k=0; k<this->n_used; k++)
+      if (this->order[k] == d->order) return this->fc + k;
+    int k = this->n_used < QUAD_CACHE_SLOTS ? this->n_used++ :
+            this->next++ % QUAD_CACHE_SLOTS;
+    this->order[k] = d->order;
+    return this->dp->eval_coeffs(this->m, d->order, d->pts_num, d->x,
+                                 d->u_prev, d->du_prevdx, this->buf[k],
+                                 this->fc + k);
+  }
+
+private:
+  DiscreteProblem *dp;
+  int m, n_used, next;
+  int order[QUAD_CACHE_SLOTS];
+  FormCoeffs fc[QUAD_CACHE_SLOTS];
+  double buf[QUAD_CACHE_SLOTS][MAX_COEFFS*QUAD_MAX_PTS] QUAD_ALIGNED;
+};
+
+// Element kernel for elements of degree P and forms of the default
+// quadrature order 2P. Does the same as the generic code in
+// DiscreteProblem::element_vol_forms() below, but all loop bounds are
+// compile-time constants, so the compiler can unroll the evaluation of the
+// previous solution and the setup of the form arguments. If 'shared' is not
+// NULL, the quadrature data of order 2P is taken from it instead (see
+// assemble_multiple(), where it is shared by several problems).
+template<int P>
+static void vol_kernel(DiscreteProblem *dp, Element *e, GeometryCache *geom,
+        int m, ElementQuadCache::Data *shared,
+        double *coeffs, int n_mfn, matrix_form *mfn, void **mud, int n_vfn,
+        vector_form *vfn, void **vud, int n_afn, vector_form_all *afn,
+        void **aud, double *local_mat, double *local_res)
+{
+  const int N = P+1;   // number of shape functions
+  const int NP = P+1;  // number of quadrature points
+  const int NPP = KernelBasis<P>::NPP;
+  const KernelBasis<P> &t = kernel_basis<P>();
+  double x_buf[NPP] QUAD_ALIGNED, w_buf[NPP] QUAD_ALIGNED;
+  double u_buf[NPP] QUAD_ALIGNED, du_buf[NPP] QUAD_ALIGNED;
+  double val_buf[N][NPP] QUAD_ALIGNED, der_buf[N][NPP] QUAD_ALIGNED;
+  double *x = x_buf, *w = w_buf, *u_prev = u_buf, *du_prevdx = du_buf;
+  double (*val)[NPP] = val_buf, (*der)[NPP] = der_buf;
+  if (shared != NULL) {
+    // same layout, the padded length of NP points being NPP
+    x = shared->x;
+    w = shared->w;
+    u_prev = shared->u_prev;
+    du_prevdx = shared->du_prevdx;
+    val = (double (*)[NPP]) shared->val;
+    der = (double (*)[NPP]) shared->der;
+  }
+  else {
+    double inv_jac;
+    if (geom != NULL && geom->get_quadrature(m, 2*P, &x, &w) >= 0)
+      inv_jac = geom->get_inv_jac(m);
+    else {
+      double a = e->v1->x, b = e->v2->x;
+      double jac = (b-a)/2.;
+      inv_jac = 1./jac;
+      for (int k=0; k<NPP; k++) {
+        x[k] = jac*t.pts[k] + (a+b)/2.;
+        w[k] = jac*t.weights[k];
+      }
+    }
+    for (int k=0; k<NPP; k++) u_prev[k] = du_prevdx[k] = 0;
+    for (int j=0; j<N; j++)
+      for (int k=0; k<NPP; k++) {
+        val[j][k] = t.val[j][k];
+        der[j][k] = t.der[j][k] * inv_jac;
+        u_prev[k] += coeffs[j]*t.val[j][k];
+        du_prevdx[k] += coeffs[j]*t.der[j][k];
+      }
+    for (int k=0; k<NPP; k++) du_prevdx[k] *= inv_jac;
+  }
+  FormCoeffs fc;
+  double coeff_buf[MAX_COEFFS*QUAD_MAX_PTS] QUAD_ALIGNED;
+  FormCoeffs *pfc = dp->eval_coeffs(m, 2*P, NP, x, u_prev, du_prevdx,
+                                    coeff_buf, &fc);
+
+  for (int i=0; i<N; i++) {
+    if (e->dof[i] == -1) continue;
+    for (int j=0; j<N; j++) {
+      if (e->dof[j] == -1) continue;
+      for (int f=0; f<n_mfn; f++)
+        local_mat[j*N + i] += mfn[f](NP, x, w, val[j], der[j], val[i],
+                                     der[i], u_prev, du_prevdx,
+                                     form_user_data(pfc, mud[f]));
+    }
+    for (int f=0; f<n_vfn; f++)
+      local_res[i] += vfn[f](NP, x, w, u_prev, du_prevdx, val[i], der[i],
+                             form_user_data(pfc, vud[f]));
+  }
+  double result[N];
+  for (int f=0; f<n_afn; f++) {
+    afn[f](NP, x, w, u_prev, du_prevdx, N, val[0], der[0], result,
+           form_user_data(pfc, aud[f]));
+    for (int i=0; i<N; i++)
+      if (e->dof[i] != -1) local_res[i] += result[i];
+  }
+}
+
+typedef void (*vol_kernel_fn)(DiscreteProblem *dp, Element *e,
+        GeometryCache *geom, int m, ElementQuadCache::Data *shared,
+        double *coeffs, int n_mfn, matrix_form *mfn, void **mud, int n_vfn,
+        vector_form *vfn, void **vud, int n_afn, vector_form_all *afn,
+        void **aud, double *local_mat, double *local_res);
+
+// degrees with a specialized kernel
+#define MAX_KERNEL_P 10
+
+static vol_kernel_fn vol_kernel_tab[MAX_KERNEL_P+1] = {
+  NULL, vol_kernel<1>, vol_kernel<2>, vol_kernel<3>, vol_kernel<4>,
+  vol_kernel<5>, vol_kernel<6>, vol_kernel<7>, vol_kernel<8>, vol_kernel<9>,
+  vol_kernel<10>
+};
+
+// Solution-independent part of the local matrices of all elements, see
+// DiscreteProblem::add_matrix_form_linear(). Recomputed when the mesh
+// revision has changed; returns false if there are no linear forms.
+bool DiscreteProblem::update_linear_cache()
+{
+  bool has_linear = false;
+  for (unsigned f=0; f<this->matrix_forms_vol.size(); f++)
+    if (this->matrix_forms_vol[f].linear) has_linear = true;
+  if (!has_linear) return false;
+  if (this->linear_revision == this->mesh->get_revision()) return true;
+
+  Element *elems = this->mesh->get_elems();
+  int n_elem = this->mesh->get_n_elems();
+  this->linear_offset.resize(n_elem+1);
+  this->linear_offset[0] = 0;
+  for (int m=0; m<n_elem; m++)
+    this->linear_offset[m+1] = this->linear_offset[m] +
+                               (elems[m].p+1)*(elems[m].p+1);
+  this->linear_mat.resize(this->linear_offset[n_elem]);
+  // the linear forms do not depend on the previous solution (NULL)
+  ElementQuadCache cache;
+  for (int m=0; m<n_elem; m++)
+    this->eval_vol_forms(m, NULL, &this->linear_mat[linear_offset[m]],
+                         NULL, 1, FORMS_LINEAR, &cache);
+  this->linear_revision = this->mesh->get_revision();
+  return true;
+}
+
+// evaluate volumetric weak forms in element 'm'. The local matrix is
+// stored row-major, local_mat[j*(p+1) + i] being the contribution to
+// mat(dof[j], dof[i]) (same orientation as the global matrix), local_res[i]
+// the contribution to res[dof[i]]. Entries of inactive dofs are set to zero.
+// Every form is integrated with the quadrature order given by its hint.
+// All forms are evaluated: the cached solution-independent part of the
+// matrix would take memory proportional to the number of elements, which
+// the element-by-element callers (FrontalSolver) avoid.
+void DiscreteProblem::element_vol_forms(int m, double *y_prev,
+        double *local_mat, double *local_res, int matrix_flag) {
+  if (this->use_batch_forms()) {
+    this->element_vol_forms_batch(1, &m, y_prev, local_mat, local_res,
+                                  matrix_flag);
+    return;
+  }
+  ElementQuadCache cache;
+  this->eval_vol_forms(m, y_prev, local_mat, local_res, matrix_flag,
+                       FORMS_ALL, &cache);
+}
+
+// same, taking the solution-independent part of the matrix from the cache
+// (see update_linear_cache()), for the assembly of the global matrix
+
+void DiscreteProblem::element_vol_forms(int m, double *y_prev,
+        double *local_mat, double *local_res, int matrix_flag,
+        ElementQuadCache *cache) {
+  if (this->use_batch_forms()) {
+    this->element_vol_forms_batch(1, &m, y_prev, local_mat, local_res,
+                                  matrix_flag);
+    return;
+  }
+  if ((matrix_flag == 0 || matrix_flag == 1) && this->update_linear_cache()) {
+    this->eval_vol_forms(m, y_prev, local_mat, local_res, matrix_flag,
+                         FORMS_NONLINEAR, cache);
+    int n_loc = this->mesh->get_elems()[m].p + 1;
+    double *cached = &this->linear_mat[this->linear_offset[m]];
+    for (int k=0; k<n_loc*n_loc; k++) local_mat[k] += cached[k];
+  }
+  else
+    this->eval_vol_forms(m, y_prev, local_mat, local_res, matrix_flag,
+                         FORMS_ALL, cache);
+}
+
+// evaluate the volumetric forms of the given part (FORMS_ALL,
+// FORMS_LINEAR: the solution-independent matrix forms only,
+// FORMS_NONLINEAR: all others) in element 'm'; y_prev == NULL stands for
+// the zero solution
+void DiscreteProblem::eval_vol_forms(int m, double *y_prev,
+        double *local_mat, double *local_res, int matrix_flag, int part,
+        ElementQuadCache *cache) {
+  Element *e = this->mesh->get_elems() + m;
+  int p = e->p;
+  int n_loc = p + 1;
+  bool do_mat = (matrix_flag == 0 || matrix_flag == 1);
+  bool do_res = (matrix_flag == 0 || matrix_flag == 2) && part != FORMS_LINEAR;
+  // indices of the matrix and vector forms to evaluate
+  int n_mfn = 0, n_vfn = 0, n_afn = 0;
+  int mfn_idx[this->matrix_forms_vol.size()+1];
+  if (do_mat)
+    for (unsigned f=0; f<this->matrix_forms_vol.size(); f++) {
+      bool linear = this->matrix_forms_vol[f].linear;
+      if (part == FORMS_ALL || linear == (part == FORMS_LINEAR))
+        mfn_idx[n_mfn++] = f;
+    }
+  if (do_res) {
+    n_vfn = this->vector_forms_vol.size();
+    n_afn = this->vector_forms_vol_all.size();
+  }
+  if (do_mat)
+    for (int k=0; k<n_loc*n_loc; k++) local_mat[k] = 0;
+  if (do_res)
+    for (int k=0; k<n_loc; k++) local_res[k] = 0;
+  double coeffs[100];
+  if (y_prev != NULL)
     calculate_elem_coeffs(this->mesh, m, y_prev, coeffs); 
-    double2 *ref_tab = g_quad_1d_std.get_points(order);
-    double pts_array[pts_num];
-    for (int j=0; j<pts_num; j++)
-        pts_array[j] = ref_tab[j][0];
-    element_solution(elems + m, coeffs, pts_num, 
-                     pts_array, phys_u_prev, phys_du_prevdx); 
+  else
+    for (int k=0; k<n_loc; k++) coeffs[k] = 0;
+  this->add_const_forms(e, coeffs, local_mat, local_res,
+                        do_mat && part != FORMS_NONLINEAR, do_res);
+  if (n_mfn == 0 && n_vfn == 0 && n_afn == 0) return;
+
+  // quadrature orders of the forms
+  int mfn_order[n_mfn+1], vfn_order[n_vfn+1], afn_order[n_afn+1];
+  bool std_order = true;
+  for (int f=0; f<n_mfn; f++) {
+    MatrixFormVol &form = this->matrix_forms_vol[mfn_idx[f]];
+    mfn_order[f] = form_quad_order(p, form.order_p_mult, form.order_offset);
+    if (mfn_order[f] != 2*p) std_order = false;
+  }
+  for (int f=0; f<n_vfn; f++) {
+    VectorFormVol &form = this->vector_forms_vol[f];
+    vfn_order[f] = form_quad_order(p, form.order_p_mult, form.order_offset);
+    if (vfn_order[f] != 2*p) std_order = false;
+  }
+  for (int f=0; f<n_afn; f++) {
+    VectorFormVolAll &form = this->vector_forms_vol_all[f];
+    afn_order[f] = form_quad_order(p, form.order_p_mult, form.order_offset);
+    if (afn_order[f] != 2*p) std_order = false;
+  }
+
+  // use the specialized kernel if there is one for this degree
+  if (std_order && p <= MAX_KERNEL_P && vol_kernel_tab[p] != NULL) {
+    matrix_form mfn[n_mfn+1];
+    vector_form vfn[n_vfn+1];
+    vector_form_all afn[n_afn+1];
+    void *mud[n_mfn+1], *vud[n_vfn+1], *aud[n_afn+1];
+    for (int f=0; f<n_mfn; f++) {
+      mfn[f] = this->matrix_forms_vol[mfn_idx[f]].fn;
+      mud[f] = this->matrix_forms_vol[mfn_idx[f]].user_data;
+    }
+    for (int f=0; f<n_vfn; f++) {
+      vfn[f] = this->vector_forms_vol[f].fn;
+      vud[f] = this->vector_forms_vol[f].user_data;
+    }
+    for (int f=0; f<n_afn; f++) {
+      afn[f] = this->vector_forms_vol_all[f].fn;
+      aud[f] = this->vector_forms_vol_all[f].user_data;
+    }
+    ElementQuadCache::Data *shared = NULL;
+    if (cache->is_shared()) {
+      cache->set_element(e, m, this->geom_cache, y_prev, coeffs);
+      shared = cache->get(2*p);
+    }
+    vol_kernel_tab[p](this, e, this->geom_cache, m, shared, coeffs, n_mfn,
+                      mfn, mud, n_vfn, vfn, vud, n_afn, afn, aud, local_mat,
+                      local_res);
+    return;
+  }
 
+  // the quadrature data is shared by all forms of the same order
+  cache->set_element(e, m, this->geom_cache, y_prev, coeffs);
+  ElementCoeffs form_coeffs(this, m);
+  // matrix forms
+  for (int f=0; f<n_mfn; f++) {
+    ElementQuadCache::Data *d = cache->get(mfn_order[f]);
+    MatrixFormVol &form = this->matrix_forms_vol[mfn_idx[f]];
+    void *ud = form_user_data(form_coeffs.get(d), form.user_data);
+    int pts_pad = quad_padded(d->pts_num);
     // loop over test functions (rows)
-    for(int i=0; i<elems[m].p + 1; i++) {
+    for(int i=0; i<n_loc; i++) {
       // if i-th test function is active
-      int pos_i = elems[m].dof[i]; // row index in matrix or residual vector
-      if(pos_i != -1) {
-        // transform i-th test function to element 'm'
-        element_shapefn(elems[m].v1->x, elems[m].v2->x,  
-                        i, order, phys_v, phys_dvdx); 
-        // if we are constructing the matrix
-        if(matrix_flag == 0 || matrix_flag == 1) {
-          // loop over basis functions (columns)
-          for(int j=0; j < elems[m].p + 1; j++) {
-            int pos_j = elems[m].dof[j]; // matrix column index
-            // if j-th basis function is active
-	    if(pos_j != -1) {
-              // transform j-th basis function to element 'm'
-              element_shapefn(elems[m].v1->x, elems[m].v2->x,  
-		 	      j, order, phys_u, phys_dudx); 
-              // evaluate the bilinear form
-              double val_ji = this->matrix_forms_vol[0].fn(pts_num, phys_pts,
-                        phys_weights, phys_u, phys_dudx, phys_v, phys_dvdx,
-                        phys_u_prev, phys_du_prevdx, NULL); 
-              // add the result to the matrix
-              mat->add(pos_j, pos_i, val_ji);
-	    }
-	  }
-        }
-        // contribute to residual vector
-        if(matrix_flag == 0 || matrix_flag == 2) {
-     	  double val_i = this->vector_forms_vol[0].fn(pts_num, phys_pts, phys_weights, 
-                                  phys_u_prev, phys_du_prevdx, phys_v,
-                                  phys_dvdx, NULL);
-          // add the contribution to the residual vector
-          if (DEBUG)
-              printf("Adding to residual pos %d value %g\n", pos_i, val_i);
-          res[pos_i] += val_i;
+      if(e->dof[i] == -1) continue;
+      double *phys_v = d->val + i*pts_pad;
+      double *phys_dvdx = d->der + i*pts_pad;
+      // loop over basis functions (columns)
+      for(int j=0; j<n_loc; j++) {
+        // if j-th basis function is active
+        if(e->dof[j] == -1) continue;
+        double *phys_u = d->val + j*pts_pad;
+        double *phys_dudx = d->der + j*pts_pad;
+        // evaluate the bilinear form
+        local_mat[j*n_loc + i] += form.fn(
+                  d->pts_num, d->x, d->w, phys_u, phys_dudx, phys_v,
+                  phys_dvdx, d->u_prev, d->du_prevdx, ud);
+      }
+    }
+  }
+  // vector forms
+  for (int f=0; f<n_vfn; f++) {
+    ElementQuadCache::Data *d = cache->get(vfn_order[f]);
+    VectorFormVol &form = this->vector_forms_vol[f];
+    void *ud = form_user_data(form_coeffs.get(d), form.user_data);
+    int pts_pad = quad_padded(d->pts_num);
+    for(int i=0; i<n_loc; i++) {
+      if(e->dof[i] == -1) continue;
+      // contribute to residual vector
+      local_res[i] += form.fn(d->pts_num, d->x, d->w,
+                              d->u_prev, d->du_prevdx, d->val + i*pts_pad,
+                              d->der + i*pts_pad, ud);
+    }
+  }
+  // vector forms taking all test functions at once
+  double result[n_loc];
+  for (int f=0; f<n_afn; f++) {
+    ElementQuadCache::Data *d = cache->get(afn_order[f]);
+    VectorFormVolAll &form = this->vector_forms_vol_all[f];
+    form.fn(d->pts_num, d->x, d->w, d->u_prev, d->du_prevdx, n_loc, d->val,
+            d->der, result, form_user_data(form_coeffs.get(d),
+                                           form.user_data));
+    for(int i=0; i<n_loc; i++)
+      if(e->dof[i] != -1) local_res[i] += result[i];
+  }
+}
+
+// Quadrature data of the n elements elem_ids[0..n-1] of degree p with the
+// solutions y_prev[0..n-1] for the given order, in the batched layout (see
+// form_utils.h); lanes e >= n repeat the last lane with zero weights.
+// Returns the number of points.
+static int batch_quad_data(Mesh *mesh, int n, int *elem_ids, double **y_prev,
+        int order, double *x, double *w, double *u_prev, double *du_prevdx,
+        double *val, double *der)
+{
+  const int W = BATCH_WIDTH;
+  Element *elems = mesh->get_elems();
+  int p = elems[elem_ids[0]].p;
+  int n_loc = p + 1;
+  double2 *ref_tab = g_quad_1d_std.get_points(order);
+  int np = g_quad_1d_std.get_num_points(order);
+  double ref_pts[np];
+  for (int k=0; k<np; k++) ref_pts[k] = ref_tab[k][0];
+  double ref_val[n_loc*np], ref_der[n_loc*np];
+  lobatto_eval(p, np, ref_pts, ref_val, ref_der);
+
+  double coeffs[100];
+  for (int e=0; e<W; e++) {
+    int m = elem_ids[e < n ? e : n-1];
+    double a = elems[m].v1->x, b = elems[m].v2->x;
+    double jac = (b-a)/2.;
+    calculate_elem_coeffs(mesh, m, y_prev[e < n ? e : n-1], coeffs);
+    for (int k=0; k<np; k++) {
+      x[k*W + e] = jac*ref_tab[k][0] + (a+b)/2.;
+      w[k*W + e] = e < n ? jac*ref_tab[k][1] : 0;
+      double up = 0, dup = 0;
+      for (int j=0; j<n_loc; j++) {
+        val[(j*np + k)*W + e] = ref_val[j*np + k];
+        der[(j*np + k)*W + e] = ref_der[j*np + k] / jac;
+        up += coeffs[j]*ref_val[j*np + k];
+        dup += coeffs[j]*ref_der[j*np + k];
+      }
+      u_prev[k*W + e] = up;
+      du_prevdx[k*W + e] = dup / jac;
+    }
+  }
+  return np;
+}
+
+void DiscreteProblem::element_vol_forms_batch(int n, int *elem_ids,
+        double *y_prev, double *local_mat, double *local_res,
+        int matrix_flag) {
+  double *y_lanes[BATCH_WIDTH];
+  for (int e=0; e<n && e<BATCH_WIDTH; e++) y_lanes[e] = y_prev;
+  this->eval_batch_forms(n, elem_ids, y_lanes, local_mat, local_res,
+                         matrix_flag);
+}
+
+void DiscreteProblem::element_vol_forms_lanes(int m, int n, double **y_prev,
+        double *local_mat, double *local_res, int matrix_flag) {
+  int elem_ids[BATCH_WIDTH];
+  for (int e=0; e<n && e<BATCH_WIDTH; e++) elem_ids[e] = m;
+  this->eval_batch_forms(n, elem_ids, y_prev, local_mat, local_res,
+                         matrix_flag);
+}
+
+// evaluate the batched volumetric weak forms in the elements
+// elem_ids[0..n-1], which all have the same degree, the e-th one with the
+// solution y_prev[e]
+void DiscreteProblem::eval_batch_forms(int n, int *elem_ids,
+        double **y_prev, double *local_mat, double *local_res,
+        int matrix_flag) {
+  const int W = BATCH_WIDTH;
+  Element *elems = this->mesh->get_elems();
+  if (n < 1 || n > W) error("Invalid number of elements in a batch.");
+  // the other volumetric forms would be ignored here
+  if (!this->use_batch_forms()) error("No batched forms are registered.");
+  int p = elems[elem_ids[0]].p;
+  int n_loc = p + 1;
+  for (int e=1; e<n; e++)
+    if (elems[elem_ids[e]].p != p)
+      error("Elements of a batch must have the same degree.");
+  int n_mfn = (matrix_flag == 0 || matrix_flag == 1) ?
+              this->matrix_forms_vol_batch.size() : 0;
+  int n_vfn = (matrix_flag == 0 || matrix_flag == 2) ?
+              this->vector_forms_vol_batch.size() : 0;
+  if (matrix_flag == 0 || matrix_flag == 1)
+    for (int k=0; k<n*n_loc*n_loc; k++) local_mat[k] = 0;
+  if (matrix_flag == 0 || matrix_flag == 2)
+    for (int k=0; k<n*n_loc; k++) local_res[k] = 0;
+  double coeffs[100];
+  for (int e=0; e<n; e++) {
+    calculate_elem_coeffs(this->mesh, elem_ids[e], y_prev[e], coeffs);
+    this->add_const_forms(elems + elem_ids[e], coeffs,
+                          local_mat + e*n_loc*n_loc, local_res + e*n_loc,
+                          matrix_flag == 0 || matrix_flag == 1,
+                          matrix_flag == 0 || matrix_flag == 2);
+  }
+
+  int max_order = 0;
+  for (int f=0; f<n_mfn; f++) {
+    MatrixFormVolBatch &form = this->matrix_forms_vol_batch[f];
+    max_order = std::max(max_order, form_quad_order(p, form.order_p_mult,
+                                                    form.order_offset));
+  }
+  for (int f=0; f<n_vfn; f++) {
+    VectorFormVolBatch &form = this->vector_forms_vol_batch[f];
+    max_order = std::max(max_order, form_quad_order(p, form.order_p_mult,
+                                                    form.order_offset));
+  }
+  int max_np = g_quad_1d_std.get_num_points(max_order);
+
+  // quadrature data of all elements of the batch, stored point-major,
+  // element-minor
+  double x[max_np*W] QUAD_ALIGNED, w[max_np*W] QUAD_ALIGNED;
+  double u_prev[max_np*W] QUAD_ALIGNED, du_prevdx[max_np*W] QUAD_ALIGNED;
+  double val[n_loc*max_np*W] QUAD_ALIGNED, der[n_loc*max_np*W] QUAD_ALIGNED;
+  int np = 0, cur_order = -1;
+  double result[W];
+
+  for (int f=0; f<n_mfn; f++) {
+    MatrixFormVolBatch &form = this->matrix_forms_vol_batch[f];
+    int order = form_quad_order(p, form.order_p_mult, form.order_offset);
+    if (order != cur_order) {
+      cur_order = order;
+      np = batch_quad_data(this->mesh, n, elem_ids, y_prev, order, x, w,
+                           u_prev, du_prevdx, val, der);
+    }
+    for (int i=0; i<n_loc; i++) {
+      for (int j=0; j<n_loc; j++) {
+        form.fn(np, x, w, val + j*np*W, der + j*np*W, val + i*np*W,
+                der + i*np*W, u_prev, du_prevdx, result, form.user_data);
+        for (int e=0; e<n; e++) {
+          int *dof = elems[elem_ids[e]].dof;
+          if (dof[i] != -1 && dof[j] != -1)
+            local_mat[e*n_loc*n_loc + j*n_loc + i] += result[e];
         }
       }
     }
+  }
+  for (int f=0; f<n_vfn; f++) {
+    VectorFormVolBatch &form = this->vector_forms_vol_batch[f];
+    int order = form_quad_order(p, form.order_p_mult, form.order_offset);
+    if (order != cur_order) {
+      cur_order = order;
+      np = batch_quad_data(this->mesh, n, elem_ids, y_prev, order, x, w,
+                           u_prev, du_prevdx, val, der);
+    }
+    for (int i=0; i<n_loc; i++) {
+      form.fn(np, x, w, u_prev, du_prevdx, val + i*np*W, der + i*np*W,
+              result, form.user_data);
+      for (int e=0; e<n; e++)
+        if (elems[elem_ids[e]].dof[i] != -1)
+          local_res[e*n_loc + i] += result[e];
+    }
+  }
+}
+
+// add the local matrix and vector of element 'e' to the global ones
+static void add_local_contributions(Element *e, Matrix *mat, double *res,
+        double *local_mat, double *local_res, int matrix_flag)
+{
+  int n_loc = e->p + 1;
+  for(int i=0; i<n_loc; i++) {
+    int pos_i = e->dof[i];
+    if(pos_i == -1) continue;
+    if(matrix_flag == 0 || matrix_flag == 1) {
+      for(int j=0; j<n_loc; j++) {
+        int pos_j = e->dof[j];
+        if(pos_j != -1) mat->add(pos_j, pos_i, local_mat[j*n_loc + i]);
+      }
+    }
+    if(matrix_flag == 0 || matrix_flag == 2) {
+      if (DEBUG)
+          printf("Adding to residual pos %d value %g\n", pos_i, local_res[i]);
+      res[pos_i] += local_res[i];
+    }
+  }
+}
+
+// process volumetric weak forms
+void DiscreteProblem::process_vol_forms(Matrix *mat, double *res, 
+              double *y_prev, int matrix_flag) {
+  Element *elems = this->mesh->get_elems();
+  int n_elem = this->mesh->get_n_elems();
+  int n_max = this->mesh->get_max_poly_order() + 1;
+  if (this->use_batch_forms()) {
+    // group the elements by degree and process them BATCH_WIDTH at a time
+    std::vector<int> by_degree(n_elem);
+    std::vector<int> first(n_max+1, 0);
+    for(int m=0; m < n_elem; m++) first[elems[m].p + 1]++;
+    for(int p=1; p <= n_max; p++) first[p] += first[p-1];
+    std::vector<int> next(first.begin(), first.end()-1);
+    for(int m=0; m < n_elem; m++) by_degree[next[elems[m].p]++] = m;
+    double *local_mat = new double[BATCH_WIDTH*n_max*n_max];
+    double *local_res = new double[BATCH_WIDTH*n_max];
+    for(int p=0; p < n_max; p++) {
+      int n_loc = p + 1;
+      for(int k=first[p]; k < first[p+1]; k += BATCH_WIDTH) {
+        int n = std::min(BATCH_WIDTH, first[p+1] - k);
+        this->element_vol_forms_batch(n, &by_degree[k], y_prev, local_mat,
+                                      local_res, matrix_flag);
+        for(int e=0; e < n; e++)
+          add_local_contributions(elems + by_degree[k+e], mat, res,
+                                  local_mat + e*n_loc*n_loc,
+                                  local_res + e*n_loc, matrix_flag);
+      }
+    }
+    delete [] local_mat;
+    delete [] local_res;
+    return;
+  }
+  double *local_mat = new double[n_max*n_max];
+  double *local_res = new double[n_max];
+  ElementQuadCache cache;
+  for(int m=0; m < n_elem; m++) {
+    element_vol_forms(m, y_prev, local_mat, local_res, matrix_flag, &cache);
+    // add the local contributions to the matrix and residual vector
+    add_local_contributions(elems + m, mat, res, local_mat, local_res,
+                            matrix_flag);
   } 
+  delete [] local_mat;
+  delete [] local_res;
 }
 
-// process left boundary weak forms
-void DiscreteProblem::process_surf_forms(Matrix *mat, double *res, 
-					 double *y_prev, int matrix_flag, int bdy_index) {
+// evaluate surface weak forms at the left or right end point. The local
+// matrix and residual belong to the boundary element (first or last one)
+// and have the same layout as in element_vol_forms().
+void DiscreteProblem::element_surf_forms(int bdy_index, double *y_prev,
+        double *local_mat, double *local_res, int matrix_flag, int lane) {
   Element *elems = this->mesh->get_elems();
   // evaluate previous solution and its derivative at the end point
   double phys_u_prev, phys_du_prevdx; // at the end point
   int m;
   if(bdy_index == BOUNDARY_LEFT) m = 0; // first element
   else m = this->mesh->get_n_elems()-1; // last element
+  int n_loc = elems[m].p + 1;
   double coeffs[100];
   calculate_elem_coeffs(this->mesh, m, y_prev, coeffs); 
-  double x_ref; 
-  if(bdy_index == BOUNDARY_LEFT) x_ref = -1; // left end of reference element
-  else x_ref = 1;                            // right end of reference element
+  double x_ref, x_phys; 
+  if(bdy_index == BOUNDARY_LEFT) {
+    x_ref = -1;                  // left end of reference element
+    x_phys = elems[m].v1->x;
+  }
+  else {
+    x_ref = 1;                   // right end of reference element
+    x_phys = elems[m].v2->x;
+  }
   // getting solution value and derivative at the boundary point
   element_solution_point(x_ref, elems + m, coeffs,
                          &phys_u_prev, &phys_du_prevdx); 
 
-  // surface integrals at the end point
-  double phys_v, phys_dvdx; 
-  double phys_u, phys_dudx;
+  DiscreteProblem::MatrixFormSurf *matrix_form_surf=NULL;
+  for (unsigned ww = 0; ww < this->matrix_forms_surf.size(); ww++) {
+    DiscreteProblem::MatrixFormSurf *mfs = &(this->matrix_forms_surf[ww]);
+    if (mfs->bdy_index == bdy_index) {
+      matrix_form_surf = mfs;
+      break;
+    }
+  }
+  DiscreteProblem::VectorFormSurf *vector_form_surf=NULL;
+  for (unsigned ww = 0; ww < this->vector_forms_surf.size(); ww++) {
+    DiscreteProblem::VectorFormSurf *vfs = &(this->vector_forms_surf[ww]);
+    if (vfs->bdy_index == bdy_index) {
+      vector_form_surf = vfs;
+      break;
+    }
+  }
+
+  void *mfs_data = NULL, *vfs_data = NULL;
+  if (matrix_form_surf != NULL) {
+    mfs_data = matrix_form_surf->user_data;
+    if (lane != -1) mfs_data = ((void **) mfs_data)[lane];
+  }
+  if (vector_form_surf != NULL) {
+    vfs_data = vector_form_surf->user_data;
+    if (lane != -1) vfs_data = ((void **) vfs_data)[lane];
+  }
+
+  // surface integrals at the end point: values and derivatives of all
+  // shape functions of the boundary element at the end point
+  double shape_val[n_loc], shape_der[n_loc];
+  lobatto_eval(elems[m].p, 1, &x_ref, shape_val, shape_der);
+  double jac = (elems[m].v2->x - elems[m].v1->x)/2.;
+  for (int k=0; k<n_loc; k++) shape_der[k] /= jac;
   // loop over test functions on the boundary element
-  for(int i=0; i<elems[m].p + 1; i++) {
+  for(int i=0; i<n_loc; i++) {
     // if i-th test function is active
     int pos_i = elems[m].dof[i]; // row index in matrix or residual vector
-    if(pos_i != -1) {
-      // transform i-th test function to the boundary element
-      element_shapefn_point(x_ref, elems[m].v1->x, elems[m].v2->x,  
-                        i, &phys_v, &phys_dvdx); 
-      // contribute to the matrix
-      if(matrix_flag == 0 || matrix_flag == 1) {
-        DiscreteProblem::MatrixFormSurf *matrix_form_surf=NULL;
-        for (int ww = 0; ww < this->matrix_forms_surf.size(); ww++) {
-          DiscreteProblem::MatrixFormSurf *vfs = &(this->matrix_forms_surf[ww]);
-          if (vfs->bdy_index == bdy_index) {
-            matrix_form_surf = vfs;
-              break;
-          }
-	}
-        if (matrix_form_surf != NULL) {
-          // loop over basis functions on the boundary element
-          for(int j=0; j < elems[m].p + 1; j++) {
-            int pos_j = elems[m].dof[j]; // matrix column index
-            // if j-th basis function is active
-	    if(pos_j != -1) {
-              // transform j-th basis function to the boundary element
-              element_shapefn_point(x_ref, elems[m].v1->x, 
-                                    elems[m].v2->x, j, &phys_u, 
-                                    &phys_dudx); 
-              // evaluate the surface bilinear form
-              double val_ji_surf = matrix_form_surf->fn(elems[m].v1->x,
-                      phys_u, phys_dudx, phys_v, 
-                      phys_dvdx, phys_u_prev, phys_du_prevdx, 
-                      NULL); 
-                // add the result to the matrix
-                mat->add(pos_j, pos_i, val_ji_surf);
-	    }
-	  }
-	}
+    double phys_v = shape_val[i], phys_dvdx = shape_der[i];
+    // contribute to the matrix
+    if(matrix_flag == 0 || matrix_flag == 1) {
+      // loop over basis functions on the boundary element
+      for(int j=0; j < n_loc; j++) {
+        int pos_j = elems[m].dof[j]; // matrix column index
+        local_mat[j*n_loc + i] = 0;
+        // if j-th basis function is active
+        if(pos_i == -1 || pos_j == -1 || matrix_form_surf == NULL) continue;
+        // evaluate the surface bilinear form
+        local_mat[j*n_loc + i] = matrix_form_surf->fn(x_phys,
+                shape_val[j], shape_der[j], phys_v, 
+                phys_dvdx, phys_u_prev, phys_du_prevdx, mfs_data);
       }
-      // contribute to residual vector
-      if(matrix_flag == 0 || matrix_flag == 2) {
-        DiscreteProblem::VectorFormSurf *vector_form_surf=NULL;
-        for (int ww = 0; ww < this->vector_forms_surf.size(); ww++) {
-          DiscreteProblem::VectorFormSurf *vfs = &(this->vector_forms_surf[ww]);
-          if (vfs->bdy_index == bdy_index) {
-            vector_form_surf = vfs;
-            break;
-          }
-        }
-        //if (vector_form_surf == NULL) error("Surface form not found.");
-        if (vector_form_surf != NULL) {
-       	  double val_i_surf = vector_form_surf->fn(elems[m].v1->x,  
-                                  phys_u_prev, phys_du_prevdx, 
-                                  phys_v, phys_dvdx, NULL);
-          // add the contribution to the residual vector
-          if (DEBUG)
-              printf("Adding to residual pos %d value %g\n", pos_i, val_i_surf);
-          res[pos_i] += val_i_surf;
-        }
+    }
+    // contribute to residual vector
+    if(matrix_flag == 0 || matrix_flag == 2) {
+      local_res[i] = 0;
+      if(pos_i != -1 && vector_form_surf != NULL)
+        local_res[i] = vector_form_surf->fn(x_phys,  
+                                phys_u_prev, phys_du_prevdx, 
+                                phys_v, phys_dvdx, vfs_data);
+    }
+  }
+}
+
+// process boundary weak forms
+void DiscreteProblem::process_surf_forms(Matrix *mat, double *res, 
+					 double *y_prev, int matrix_flag, int bdy_index) {
+  Element *elems = this->mesh->get_elems();
+  int m;
+  if(bdy_index == BOUNDARY_LEFT) m = 0; // first element
+  else m = this->mesh->get_n_elems()-1; // last element
+  int n_loc = elems[m].p + 1;
+  double *local_mat = new double[n_loc*n_loc];
+  double *local_res = new double[n_loc];
+  element_surf_forms(bdy_index, y_prev, local_mat, local_res, matrix_flag);
+  for(int i=0; i<n_loc; i++) {
+    int pos_i = elems[m].dof[i];
+    if(pos_i == -1) continue;
+    if(matrix_flag == 0 || matrix_flag == 1) {
+      for(int j=0; j<n_loc; j++) {
+        int pos_j = elems[m].dof[j];
+        if(pos_j != -1) mat->add(pos_j, pos_i, local_mat[j*n_loc + i]);
       }
     }
+    if(matrix_flag == 0 || matrix_flag == 2) {
+      if (DEBUG)
+          printf("Adding to residual pos %d value %g\n", pos_i, local_res[i]);
+      res[pos_i] += local_res[i];
+    }
   }
+  delete [] local_mat;
+  delete [] local_res;
 }
 
 // construct Jacobi matrix or residual vector
@@ -271,9 +1352,146 @@ void DiscreteProblem::assemble_vector(double *res, double *y_prev) {
   assemble(void_mat, res, y_prev, 2);
 } 
 
+// assemble the matrices (and residual vectors) of several problems on the
+// same mesh in one element loop
+void DiscreteProblem::assemble_multiple(int n, DiscreteProblem **dp,
+        Matrix **mat, double **res, double *y_prev) {
+  Mesh *mesh = dp[0]->mesh;
+  for (int k=1; k<n; k++)
+    if (dp[k]->mesh != mesh) error("The problems must share the mesh.");
+  Element *elems = mesh->get_elems();
+  int n_elem = mesh->get_n_elems();
+  int n_max = mesh->get_max_poly_order() + 1;
+  int flag[n];
+  for (int k=0; k<n; k++) {
+    flag[k] = (res == NULL || res[k] == NULL) ? 1 : 0;
+    if (flag[k] == 0)
+      for (int i=0; i<mesh->get_n_dof(); i++) res[k][i] = 0;
+  }
+  double *local_mat = new double[n_max*n_max];
+  double *local_res = new double[n_max];
+  ElementQuadCache cache(true);
+  for (int m=0; m<n_elem; m++) {
+    for (int k=0; k<n; k++) {
+      dp[k]->element_vol_forms(m, y_prev, local_mat, local_res, flag[k],
+                               &cache);
+      add_local_contributions(elems + m, mat[k], flag[k] ? NULL : res[k],
+                              local_mat, local_res, flag[k]);
+    }
+  }
+  delete [] local_mat;
+  delete [] local_res;
+  for (int k=0; k<n; k++) {
+    double *r = flag[k] ? NULL : res[k];
+    if (mesh->bc_left_dir[0] != 1)
+      dp[k]->process_surf_forms(mat[k], r, y_prev, flag[k], BOUNDARY_LEFT);
+    if (mesh->bc_right_dir[0] != 1)
+      dp[k]->process_surf_forms(mat[k], r, y_prev, flag[k], BOUNDARY_RIGHT);
+  }
+}
+
+// volumetric and surface forms of element 'm', as element_vol_forms()
+// with matrix_flag == 0; 'surf_mat' and 'surf_res' are work arrays
+void DiscreteProblem::element_forms(int m, double *y_prev, double *local_mat,
+        double *local_res, double *surf_mat, double *surf_res) {
+  int n_elem = this->mesh->get_n_elems();
+  int n_loc = this->mesh->get_elems()[m].p + 1;
+  ElementQuadCache cache;
+  this->element_vol_forms(m, y_prev, local_mat, local_res, 0, &cache);
+  for (int bdy=0; bdy<2; bdy++) {
+    int bdy_index = bdy == 0 ? BOUNDARY_LEFT : BOUNDARY_RIGHT;
+    int bdy_elem = bdy == 0 ? 0 : n_elem-1;
+    int *bc_dir = bdy == 0 ? this->mesh->bc_left_dir : this->mesh->bc_right_dir;
+    if (m != bdy_elem || bc_dir[0] == 1) continue;
+    this->element_surf_forms(bdy_index, y_prev, surf_mat, surf_res, 0);
+    for (int k=0; k<n_loc*n_loc; k++) local_mat[k] += surf_mat[k];
+    for (int k=0; k<n_loc; k++) local_res[k] += surf_res[k];
+  }
+}
+
+void DiscreteProblem::reset_incremental() {
+  this->inc_mat = NULL;
+  this->inc_res = NULL;
+}
+
+// Incremental assembly: the local matrices and vectors of all elements and
+// the solution coefficients they were computed with are kept, an element
+// is reassembled only if one of its coefficients has changed by more than
+// 'tol', and the difference between its new and old contributions is
+// added to 'mat' and 'res'.
+int DiscreteProblem::assemble_incremental(Matrix *mat, double *res,
+        double *y_prev, double tol) {
+  Element *elems = this->mesh->get_elems();
+  int n_elem = this->mesh->get_n_elems();
+  int n_max = this->mesh->get_max_poly_order() + 1;
+  bool full = (mat != this->inc_mat || res != this->inc_res ||
+               this->inc_revision != this->mesh->get_revision());
+  if (full) {
+    this->inc_offset.resize(n_elem+1);
+    this->inc_offset[0] = 0;
+    for (int m=0; m<n_elem; m++)
+      this->inc_offset[m+1] = this->inc_offset[m] + elems[m].p + 1;
+    int n_coeffs = this->inc_offset[n_elem];
+    this->inc_local_res.assign(n_coeffs, 0.);
+    this->inc_coeffs.assign(n_coeffs, 0.);
+    this->inc_local_mat.resize(0);
+    this->inc_mat_offset.resize(n_elem+1);
+    this->inc_mat_offset[0] = 0;
+    for (int m=0; m<n_elem; m++)
+      this->inc_mat_offset[m+1] = this->inc_mat_offset[m] +
+                                  (elems[m].p+1)*(elems[m].p+1);
+    this->inc_local_mat.assign(this->inc_mat_offset[n_elem], 0.);
+    mat->zero();
+    for (int i=0; i<this->mesh->get_n_dof(); i++) res[i] = 0;
+    this->inc_mat = mat;
+    this->inc_res = res;
+    this->inc_revision = this->mesh->get_revision();
+  }
+
+  double *local_mat = new double[n_max*n_max];
+  double *local_res = new double[n_max];
+  double *surf_mat = new double[n_max*n_max];
+  double *surf_res = new double[n_max];
+  double coeffs[100];
+  int n_dirty = 0;
+  for (int m=0; m<n_elem; m++) {
+    int n_loc = elems[m].p + 1;
+    double *old_coeffs = &this->inc_coeffs[this->inc_offset[m]];
+    calculate_elem_coeffs(this->mesh, m, y_prev, coeffs);
+    bool dirty = full;
+    for (int j=0; j<n_loc && !dirty; j++)
+      if (fabs(coeffs[j] - old_coeffs[j]) > tol) dirty = true;
+    if (!dirty) continue;
+    n_dirty++;
+    for (int j=0; j<n_loc; j++) old_coeffs[j] = coeffs[j];
+    this->element_forms(m, y_prev, local_mat, local_res, surf_mat, surf_res);
+    // replace the old contributions by the new ones
+    double *old_mat = &this->inc_local_mat[this->inc_mat_offset[m]];
+    double *old_res = &this->inc_local_res[this->inc_offset[m]];
+    for (int k=0; k<n_loc*n_loc; k++) {
+      double v = local_mat[k];
+      local_mat[k] -= old_mat[k];
+      old_mat[k] = v;
+    }
+    for (int k=0; k<n_loc; k++) {
+      double v = local_res[k];
+      local_res[k] -= old_res[k];
+      old_res[k] = v;
+    }
+    add_local_contributions(elems + m, mat, res, local_mat, local_res, 0);
+  }
+  delete [] local_mat;
+  delete [] local_res;
+  delete [] surf_mat;
+  delete [] surf_res;
+  return n_dirty;
+}
+
 // transformation of quadrature to physical element
 void element_quadrature(double a, double b, 
                         int order, double *pts, double *weights, int *num) {
+  if (order > g_quad_1d_std.get_max_order())
+    error("Quadrature order is too high.");
   double2 *ref_tab = g_quad_1d_std.get_points(order);
   *num = g_quad_1d_std.get_num_points(order);
   for (int i=0;i<*num;i++) {
@@ -289,12 +1507,20 @@ void element_shapefn(double a, double b,
 		     int k, int order, double *val, double *der) {
   double2 *ref_tab = g_quad_1d_std.get_points(order);
   int pts_num = g_quad_1d_std.get_num_points(order);
+  double *pts = new double[pts_num];
+  for (int i=0 ; i<pts_num; i++) pts[i] = ref_tab[i][0];
+  double *shape_val = new double[(k+1)*pts_num];
+  double *shape_der = new double[(k+1)*pts_num];
+  lobatto_eval(k, pts_num, pts, shape_val, shape_der);
+  double jac = (b-a)/2.; 
   for (int i=0 ; i<pts_num; i++) {
     // change function values and derivatives to interval (a, b)
-    val[i] = lobatto_fn_tab_1d[k](ref_tab[i][0]);
-    double jac = (b-a)/2.; 
-    der[i] = lobatto_der_tab_1d[k](ref_tab[i][0]) / jac; 
+    val[i] = shape_val[k*pts_num + i];
+    der[i] = shape_der[k*pts_num + i] / jac; 
   }
+  delete [] pts;
+  delete [] shape_val;
+  delete [] shape_der;
 };
 
 // evaluate previous solution and its derivative 
@@ -306,24 +1532,31 @@ void element_solution(Element *e, double *coeff, int pts_num,
   double b = e->v2->x;
   double jac = (b-a)/2.; 
   int p = e->p;
-  for (int i=0 ; i<pts_num; i++) {
-    der[i] = val[i] = 0;
-    for(int j=0; j<=p; j++) {
-      val[i] += coeff[j]*lobatto_fn_tab_1d[j](pts_array[i]);
-      der[i] += coeff[j]*lobatto_der_tab_1d[j](pts_array[i]);
+  double *shape_val = new double[(p+1)*pts_num];
+  double *shape_der = new double[(p+1)*pts_num];
+  lobatto_eval(p, pts_num, pts_array, shape_val, shape_der);
+  for (int i=0 ; i<pts_num; i++) der[i] = val[i] = 0;
+  for(int j=0; j<=p; j++) {
+    for (int i=0 ; i<pts_num; i++) {
+      val[i] += coeff[j]*shape_val[j*pts_num + i];
+      der[i] += coeff[j]*shape_der[j*pts_num + i];
     }
-    der[i] /= jac;
   }
+  for (int i=0 ; i<pts_num; i++) der[i] /= jac;
+  delete [] shape_val;
+  delete [] shape_der;
 } 
 
 // transformation of k-th shape function at the reference 
 // point x_ref to physical interval (a,b).
 void element_shapefn_point(double x_ref, double a, double b, 
 		     int k, double *val, double *der) {
+    double shape_val[k+1], shape_der[k+1];
+    lobatto_eval(k, 1, &x_ref, shape_val, shape_der);
     // change function values and derivatives to interval (a, b)
-    *val = lobatto_fn_tab_1d[k](x_ref);
+    *val = shape_val[k];
     double jac = (b-a)/2.; 
-    *der = lobatto_der_tab_1d[k](x_ref) / jac; 
+    *der = shape_der[k] / jac; 
 }
 
 // evaluate previous solution and its derivative 
@@ -335,12 +1568,12 @@ void element_solution_point(double x_ref, Element *e,
   double b = e->v2->x;
   double jac = (b-a)/2.; 
   int p = e->p;
+  double shape_val[p+1], shape_der[p+1];
+  lobatto_eval(p, 1, &x_ref, shape_val, shape_der);
   *der = *val = 0;
   for(int j=0; j<=p; j++) {
-    *val += coeff[j]*lobatto_fn_tab_1d[j](x_ref);
-    *der += coeff[j]*lobatto_der_tab_1d[j](x_ref);
+    *val += coeff[j]*shape_val[j];
+    *der += coeff[j]*shape_der[j];
   }
   *der /= jac;
 } 
-
-
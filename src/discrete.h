@@ -7,7 +7,15 @@
 #include "quad_std.h"
 #include "lobatto.h"
 #include "matrix.h"
+#include "form_utils.h"
 
+// Constant-coefficient forms (see DiscreteProblem::add_matrix_form_const())
+#define FORM_STIFFNESS 0  // c * u' * v'
+#define FORM_MASS 1       // c * u * v
+#define FORM_ADVECTION 2  // c * u' * v
+
+// The arrays passed to the volumetric forms are aligned and padded, see
+// form_utils.h.
 typedef double (*matrix_form) (int num, double *x, double *weights,
         double *u, double *dudx, double *v, double *dvdx, double *u_prev,
         double *du_prevdx, void *user_data);
@@ -16,6 +24,52 @@ typedef double (*vector_form) (int num, double *x, double *weights,
         double *u_prev, double *du_prevdx, double *v, double *dvdx,
         void *user_data);
 
+// Vector form evaluating all n_test test functions at once: the values
+// and derivatives of the i-th test function start at v + i*quad_padded(num)
+// and dvdx + i*quad_padded(num), the form stores its value for the i-th
+// test function in result[i]. Coefficient functions, e.g. a source term
+// f(x[k]), then only need to be evaluated once per quadrature point.
+typedef void (*vector_form_all) (int num, double *x, double *weights,
+        double *u_prev, double *du_prevdx, int n_test, double *v,
+        double *dvdx, double *result, void *user_data);
+
+// Batched volumetric forms, evaluated for BATCH_WIDTH elements at once;
+// the arrays are in the point-major, element-minor layout described in
+// form_utils.h and the value for the e-th element is stored in result[e].
+typedef void (*matrix_form_batch) (int num, double *x, double *weights,
+        double *u, double *dudx, double *v, double *dvdx, double *u_prev,
+        double *du_prevdx, double *result, void *user_data);
+
+typedef void (*vector_form_batch) (int num, double *x, double *weights,
+        double *u_prev, double *du_prevdx, double *v, double *dvdx,
+        double *result, void *user_data);
+
+// Coefficient function (see DiscreteProblem::add_coeff()): stores its
+// values at the points x[0..num-1] in val[0..num-1]. u_prev and du_prevdx
+// are NULL for coefficients which do not depend on the solution.
+typedef void (*coeff_fn) (int num, double *x, double *u_prev,
+        double *du_prevdx, double *val);
+
+// maximum number of coefficient functions of a DiscreteProblem
+#define MAX_COEFFS 8
+
+/// Values of the coefficient functions at the quadrature points of an
+/// element, passed to the volumetric forms as user_data if coefficient
+/// functions are registered. val[c] is padded like the other arrays of
+/// the form (the padding entries are zero); user_data is the pointer
+/// given when the form was registered.
+struct FormCoeffs {
+    int n;
+    double *val[MAX_COEFFS];
+    void *user_data;
+};
+
+/// Values of the c-th coefficient function inside a volumetric form.
+inline double *form_coeff(void *user_data, int c)
+{
+    return ((FormCoeffs *) user_data)->val[c];
+}
+
 typedef double (*matrix_form_surf) (double x, double u, double dudx, 
         double v, double dvdx, double u_prev, double du_prevdx, 
         void *user_data);
@@ -24,15 +78,173 @@ typedef double (*vector_form_surf) (double x, double u_prev,
         double du_prevdx, double v, double dvdx,
         void *user_data);
 
+class ElementQuadCache;
+
+/// \brief Cache of the element geometry.
+///
+/// Keeps the physical quadrature points and weights (padded as described in
+/// form_utils.h) of all elements for each quadrature order used, and the
+/// inverse Jacobians of the elements, so that they are not recomputed in
+/// every assembly. The data of a quadrature order is computed for all
+/// elements when it is first needed, unless that would exceed the memory
+/// budget, in which case the data is computed on the fly as without the
+/// cache. All data is dropped when the mesh revision changes (see
+/// Mesh::get_revision()); moving the vertices directly does not change
+/// the revision, call clear() then.
+///
+/// The forms receive pointers into the cache, they must not write to the
+/// arrays x and weights. Unlike a DiscreteProblem, one cache may be shared
+/// by the problems of several threads (see EnsembleSolver), as long as the
+/// mesh does not change meanwhile.
+class GeometryCache {
+public:
+    GeometryCache(Mesh *mesh, size_t max_bytes=64*1024*1024);
+    ~GeometryCache();
+
+    /// Drops all data.
+    void clear();
+    /// Sets 'x' and 'w' to the points and weights of the quadrature of
+    /// 'order' in element 'm' and returns their number, or returns -1 if
+    /// the order does not fit into the memory budget.
+    int get_quadrature(int m, int order, double **x, double **w);
+    /// Returns 2/(x_right - x_left) of element 'm'.
+    double get_inv_jac(int m);
+    /// Memory used (in bytes).
+    size_t get_size() {
+        return this->size;
+    }
+
+private:
+    Mesh *mesh;
+    int revision;
+    size_t max_bytes, size;
+    double *inv_jac;
+    // per quadrature order: raw allocation and aligned start of the
+    // points and weights of all elements (element m at m*pad, pad being
+    // the padded number of points); 'failed' marks orders over budget
+    std::vector<double *> raw, data;
+    std::vector<bool> failed;
+
+    void update();
+    bool add_order(int order);
+};
+
+/// A DiscreteProblem keeps caches which are filled during the assembly
+/// without synchronization, so it must not be used by several threads at
+/// once; parallel solvers create one problem per thread (see
+/// EnsembleSolver).
 class DiscreteProblem {
 
 public:
     DiscreteProblem(int neq, Mesh *mesh);
 
-    void add_matrix_form(int i, int j, matrix_form fn);
-    void add_vector_form(int i, vector_form fn);
-    void add_matrix_form_surf(int i, int j, matrix_form_surf fn, int bdy_index);
-    void add_vector_form_surf(int i, vector_form_surf fn, int bdy_index);
+    /// Registers a volumetric form. The pointer 'user_data' is passed to
+    /// every call of the form (through FormCoeffs::user_data if coefficient
+    /// functions are registered), so that parameters of the form need not
+    /// be global variables; this holds for all add_*_form*() functions
+    /// taking it. The optional order hint declares the
+    /// polynomial degree of the integrand in an element of degree p as
+    /// order_p_mult*p + order_offset; the form is integrated with the
+    /// Gauss rule of exactly this order. The default (2p) is exact for
+    /// u*v with constant coefficients, use e.g. order_offset=-2 for a
+    /// plain u'*v' term, order_offset=2 for x*x*u*v, and order_p_mult=0
+    /// for an absolute order. All forms registered are summed up.
+    void add_matrix_form(int i, int j, matrix_form fn, int order_offset=0,
+                         int order_p_mult=2, void *user_data=NULL);
+    void add_vector_form(int i, vector_form fn, int order_offset=0,
+                         int order_p_mult=2, void *user_data=NULL);
+    /// Registers a vector form taking all test functions at once, see
+    /// vector_form_all. Its results are added to those of the other vector
+    /// forms.
+    void add_vector_form_all(int i, vector_form_all fn, int order_offset=0,
+                             int order_p_mult=2, void *user_data=NULL);
+    /// Registers a coefficient function and returns its index c, under
+    /// which the volumetric forms find its values with form_coeff(). The
+    /// coefficients are evaluated once per element and quadrature order
+    /// instead of inside every (i, j) evaluation of the forms. Unless
+    /// 'depends_on_solution' is set, the values are computed only once per
+    /// mesh revision and reused by all later assemblies (e.g. in all Newton
+    /// iterations). The batched forms do not receive coefficients.
+    int add_coeff(coeff_fn fn, bool depends_on_solution=false);
+    /// Evaluates the coefficient functions in element m at the num points
+    /// x of the given quadrature order; the values are stored in 'buf'
+    /// (MAX_COEFFS*QUAD_MAX_PTS entries, aligned to QUAD_ALIGN bytes) and
+    /// referenced from 'fc'. Returns fc, or NULL if there are no
+    /// coefficient functions.
+    FormCoeffs *eval_coeffs(int m, int order, int num, double *x,
+                            double *u_prev, double *du_prevdx, double *buf,
+                            FormCoeffs *fc);
+    int get_n_coeffs() {
+        return this->coeffs.size();
+    }
+    /// Registers a matrix form which does not depend on u_prev (the
+    /// arguments u_prev and du_prevdx are then meaningless). The local
+    /// matrices of all such forms, together with the constant-coefficient
+    /// matrix forms, are computed once per mesh revision (see
+    /// Mesh::get_revision()) and kept; every assembly of a global matrix
+    /// then only evaluates the remaining forms and adds the stored part.
+    /// The frontal solvers evaluate all forms element by element instead,
+    /// so that their memory does not grow with the number of elements.
+    void add_matrix_form_linear(int i, int j, matrix_form fn,
+                                int order_offset=0, int order_p_mult=2,
+                                void *user_data=NULL);
+    /// Batched versions of add_matrix_form() and add_vector_form(). If
+    /// batched forms are given, process_vol_forms() groups the elements by
+    /// their degree and evaluates the forms for BATCH_WIDTH elements at
+    /// a time, which pays off for low degrees where a single element has
+    /// too few quadrature points to fill the vector units. Batched forms
+    /// can only be combined with the constant-coefficient forms: if any
+    /// batched form is registered, the volumetric forms registered by
+    /// add_matrix_form(), add_matrix_form_linear(), add_vector_form() and
+    /// add_vector_form_all(), and the coefficient functions, are not
+    /// supported, and the assembly stops with an error.
+    void add_matrix_form_batch(int i, int j, matrix_form_batch fn,
+                               int order_offset=0, int order_p_mult=2,
+                               void *user_data=NULL);
+    void add_vector_form_batch(int i, vector_form_batch fn,
+                               int order_offset=0, int order_p_mult=2,
+                               void *user_data=NULL);
+    /// True if batched forms are registered; calls error() if other
+    /// volumetric forms (see above) are registered as well.
+    bool use_batch_forms();
+    /// Registers the constant-coefficient form of the given type
+    /// (FORM_STIFFNESS, FORM_MASS or FORM_ADVECTION) with the coefficient
+    /// c. It is assembled from precomputed matrices on the reference
+    /// element, scaled by the element Jacobian, without any quadrature,
+    /// and is added to the other matrix forms. The vector form version
+    /// adds the same term applied to the previous solution, e.g.
+    /// c * u_prev' * v' for FORM_STIFFNESS, to the residual.
+    void add_matrix_form_const(int i, int j, int type, double c);
+    void add_vector_form_const(int i, int type, double c);
+    void add_matrix_form_surf(int i, int j, matrix_form_surf fn, int bdy_index,
+                              void *user_data=NULL);
+    void add_vector_form_surf(int i, vector_form_surf fn, int bdy_index,
+                              void *user_data=NULL);
+    /// Evaluates the volumetric forms in element m. Unlike the global
+    /// assembly, it does not use the stored solution-independent part of
+    /// the matrices (see add_matrix_form_linear()), so it keeps no data
+    /// per element.
+    void element_vol_forms(int m, double *y_prev, double *local_mat,
+                           double *local_res, int matrix_flag);
+    /// Same as element_vol_forms() for the n <= BATCH_WIDTH elements
+    /// elem_ids[0..n-1] of equal degree, using the batched forms; the local
+    /// matrix and vector of the e-th element start at local_mat +
+    /// e*(p+1)*(p+1) and local_res + e*(p+1).
+    void element_vol_forms_batch(int n, int *elem_ids, double *y_prev,
+                                 double *local_mat, double *local_res,
+                                 int matrix_flag);
+    /// Same for n <= BATCH_WIDTH different solutions y_prev[0..n-1] in the
+    /// single element m: lane e of the batched forms is evaluated with
+    /// y_prev[e], which lets several problems with the same mesh and forms
+    /// be assembled in lockstep (see FrontalSolverBatch).
+    void element_vol_forms_lanes(int m, int n, double **y_prev,
+                                 double *local_mat, double *local_res,
+                                 int matrix_flag);
+    /// If 'lane' is not -1, the user_data of the surface forms must be an
+    /// array of BATCH_WIDTH pointers, and the forms receive its entry
+    /// 'lane' (see FrontalSolverBatch).
+    void element_surf_forms(int bdy_index, double *y_prev, double *local_mat,
+                            double *local_res, int matrix_flag, int lane=-1);
     void process_vol_forms(Matrix *mat, double *res, double *y_prev, int matrix_flag);
     void process_surf_forms(Matrix *mat, double *res, double *y_prev, 
                             int matrix_flag, int bdy_index);
@@ -40,28 +252,143 @@ public:
     void assemble_matrix_and_vector(Matrix *mat, double *res, double *y_prev); 
     void assemble_matrix(Matrix *mat, double *y_prev);
     void assemble_vector(double *res, double *y_prev);
+    /// Assembles the Jacobi matrix and the residual vector like
+    /// assemble_matrix_and_vector(), but keeps the local contributions of
+    /// all elements. On the first call, and whenever 'mat' or 'res' differ
+    /// from the previous call or the mesh has changed, 'mat' and 'res' are
+    /// zeroed and fully assembled. Later calls only reassemble the
+    /// elements where some solution coefficient has changed by more than
+    /// 'tol' since the element was last assembled, and update 'mat' and
+    /// 'res' by the difference of the new and old contributions. 'mat' and
+    /// 'res' must not be modified in between (note that solve_linear_system()
+    /// overwrites 'res' and may factorize 'mat' in place). Returns the
+    /// number of reassembled elements.
+    int assemble_incremental(Matrix *mat, double *res, double *y_prev,
+                             double tol=0);
+    /// Assembles the Jacobi matrices mat[k] (and, if 'res' is not NULL, the
+    /// residual vectors res[k]; single entries may be NULL as well) of the
+    /// n problems dp[0..n-1], which must be defined on the same mesh, at
+    /// y_prev in one pass over the mesh. Quadrature points, weights, shape
+    /// functions and the previous solution are computed once per element
+    /// and quadrature order and shared by all problems. E.g. the stiffness
+    /// and mass matrix of an eigenproblem can be assembled at once.
+    static void assemble_multiple(int n, DiscreteProblem **dp, Matrix **mat,
+                                  double **res, double *y_prev);
+    /// Uses 'cache' (which must belong to the mesh of this problem) for the
+    /// element geometry, or no cache if NULL.
+    void set_geometry_cache(GeometryCache *cache) {
+        this->geom_cache = cache;
+    }
+    /// Forces a full assembly on the next call of assemble_incremental().
+    void reset_incremental();
+
+    Mesh *get_mesh() {
+        return this->mesh;
+    }
 
 private:
     int neq;
     Mesh *mesh;
+    GeometryCache *geom_cache;
+
+    // cached solution-independent part of the local matrices, stored
+    // element by element starting at linear_offset[m]
+    std::vector<double> linear_mat;
+    std::vector<int> linear_offset;
+    int linear_revision;
+
+    // state of assemble_incremental(): local matrices (at inc_mat_offset[m])
+    // and vectors and solution coefficients (at inc_offset[m]) of element m
+    Matrix *inc_mat;
+    double *inc_res;
+    int inc_revision;
+    std::vector<double> inc_local_mat, inc_local_res, inc_coeffs;
+    std::vector<int> inc_offset, inc_mat_offset;
+
+    // values of the solution-independent coefficient functions for each
+    // quadrature order, element by element
+    struct CoeffFn {
+        coeff_fn fn;
+        bool depends_on_solution;
+    };
+    struct CoeffCache {
+        std::vector<double> val;
+        bool done;
+        CoeffCache() {
+            this->done = false;
+        }
+    };
+    std::vector<CoeffFn> coeffs;
+    std::vector<CoeffCache> coeff_cache;
+    int coeff_revision;
+
+    void element_forms(int m, double *y_prev, double *local_mat,
+                       double *local_res, double *surf_mat, double *surf_res);
+    bool update_linear_cache();
+    void update_coeff_cache(int order);
+    void element_vol_forms(int m, double *y_prev, double *local_mat,
+                           double *local_res, int matrix_flag,
+                           ElementQuadCache *cache);
+    void eval_batch_forms(int n, int *elem_ids, double **y_prev,
+                          double *local_mat, double *local_res,
+                          int matrix_flag);
+    void eval_vol_forms(int m, double *y_prev, double *local_mat,
+                        double *local_res, int matrix_flag, int part,
+                        ElementQuadCache *cache);
+    void add_const_forms(Element *e, double *coeffs, double *local_mat,
+                         double *local_res, bool do_mat, bool do_res);
 
 	struct MatrixFormVol {
 		int i, j;
 		matrix_form fn;
+		int order_offset, order_p_mult;
+		bool linear;
+		void *user_data;
+	};
+	struct VectorFormVolAll {
+		int i;
+		vector_form_all fn;
+		int order_offset, order_p_mult;
+		void *user_data;
+	};
+	struct MatrixFormVolBatch {
+		int i, j;
+		matrix_form_batch fn;
+		int order_offset, order_p_mult;
+		void *user_data;
+	};
+	struct VectorFormVolBatch {
+		int i;
+		vector_form_batch fn;
+		int order_offset, order_p_mult;
+		void *user_data;
+	};
+	struct FormConst {
+		int i, j, type;
+		double c;
 	};
 	struct MatrixFormSurf {
 		int i, j, bdy_index;
 		matrix_form_surf fn;
+		void *user_data;
 	};
 	struct VectorFormVol {
 		int i;
 		vector_form fn;
+		int order_offset, order_p_mult;
+		void *user_data;
 	};
 	struct VectorFormSurf {
 		int i, bdy_index;
 		vector_form_surf fn;
+		void *user_data;
 	};
 	std::vector<MatrixFormVol> matrix_forms_vol;
+	std::vector<VectorFormVolAll> vector_forms_vol_all;
+	std::vector<MatrixFormVolBatch> matrix_forms_vol_batch;
+	std::vector<VectorFormVolBatch> vector_forms_vol_batch;
+	std::vector<FormConst> matrix_forms_const;
+	std::vector<FormConst> vector_forms_const;
 	std::vector<MatrixFormSurf> matrix_forms_surf;
 	std::vector<VectorFormVol> vector_forms_vol;
 	std::vector<VectorFormSurf> vector_forms_surf;
@@ -0,0 +1,160 @@
+#include <sys/time.h>
+
+#include "ensemble.h"
+#include "frontal.h"
+
+static double wall_time()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1e-6*tv.tv_usec;
+}
+
+EnsembleSolver::EnsembleSolver(Mesh *mesh, ensemble_setup setup, double tol,
+        int max_iter) : geom_cache(mesh)
+{
+  this->mesh = mesh;
+  this->setup = setup;
+  this->setup_batch = NULL;
+  this->tol = tol;
+  this->max_iter = max_iter;
+  this->time = 0;
+}
+
+EnsembleSolver::EnsembleSolver(Mesh *mesh, ensemble_setup_batch setup,
+        double tol, int max_iter) : geom_cache(mesh)
+{
+  this->mesh = mesh;
+  this->setup = NULL;
+  this->setup_batch = setup;
+  this->tol = tol;
+  this->max_iter = max_iter;
+  this->time = 0;
+}
+
+int EnsembleSolver::solve(int n, void **params, double *y, double *y_init)
+{
+  this->iterations.assign(n, -1);
+  double start = wall_time();
+  int n_converged;
+  if (this->setup_batch != NULL)
+    n_converged = this->solve_lockstep(n, params, y, y_init);
+  else
+    n_converged = this->solve_single(n, params, y, y_init);
+  this->time = wall_time() - start;
+  return n_converged;
+}
+
+int EnsembleSolver::solve_single(int n, void **params, double *y,
+        double *y_init)
+{
+  int n_dof = this->mesh->get_n_dof();
+  int n_converged = 0;
+
+  // the members take different numbers of Newton iterations, so they are
+  // handed out to the threads one at a time
+  #pragma omp parallel
+  {
+    double *dy = new double[n_dof];
+    #pragma omp for schedule(dynamic) reduction(+:n_converged)
+    for (int k=0; k<n; k++) {
+      DiscreteProblem dp(this->mesh->get_n_eqn(), this->mesh);
+      dp.set_geometry_cache(&this->geom_cache);
+      this->setup(&dp, params[k]);
+      FrontalSolver solver(&dp);
+
+      double *y_k = y + (size_t) k*n_dof;
+      for (int i=0; i<n_dof; i++) y_k[i] = y_init != NULL ? y_init[i] : 0;
+      for (int it=0; it<=this->max_iter; it++) {
+        double res_norm = solver.solve(y_k, dy);
+        if (res_norm < this->tol) {
+          this->iterations[k] = it;
+          n_converged++;
+          break;
+        }
+        if (!(res_norm < 1e100)) break;  // diverged
+        for (int i=0; i<n_dof; i++) y_k[i] += dy[i];
+      }
+    }
+    delete [] dy;
+  }
+  return n_converged;
+}
+
+int EnsembleSolver::solve_lockstep(int n, void **params, double *y,
+        double *y_init)
+{
+  const int W = BATCH_WIDTH;
+  int n_dof = this->mesh->get_n_dof();
+  int n_converged = 0;
+  int next = 0;   // next member to be started
+
+  #pragma omp parallel reduction(+:n_converged)
+  {
+    // state of the lanes: lanes 0..n_active-1 hold the members member[e],
+    // the solution of which is y_lane[e]
+    void *lane_params[W];
+    int member[W], iter[W];
+    double *y_lane[W], *dy_lane[W], res_norm[W];
+    for (int e=0; e<W; e++) {
+      lane_params[e] = n > 0 ? params[0] : NULL;
+      member[e] = -1;
+      dy_lane[e] = new double[n_dof];
+    }
+    DiscreteProblem dp(this->mesh->get_n_eqn(), this->mesh);
+    dp.set_geometry_cache(&this->geom_cache);
+    this->setup_batch(&dp, lane_params);
+    FrontalSolverBatch solver(&dp);
+
+    int n_active = W;
+    while (1) {
+      // start new members in the free lanes; if there are none left,
+      // move the last active lane into the free one
+      for (int e=0; e<n_active; ) {
+        if (member[e] != -1) {
+          e++;
+          continue;
+        }
+        int k;
+        #pragma omp atomic capture
+        k = next++;
+        if (k < n) {
+          member[e] = k;
+          iter[e] = 0;
+          lane_params[e] = params[k];
+          y_lane[e] = y + (size_t) k*n_dof;
+          for (int i=0; i<n_dof; i++)
+            y_lane[e][i] = y_init != NULL ? y_init[i] : 0;
+          e++;
+        }
+        else {
+          n_active--;
+          member[e] = member[n_active];
+          iter[e] = iter[n_active];
+          lane_params[e] = lane_params[n_active];
+          y_lane[e] = y_lane[n_active];
+          member[n_active] = -1;
+        }
+      }
+      if (n_active == 0) break;
+
+      // one Newton step of all active members
+      solver.solve(n_active, y_lane, dy_lane, res_norm);
+      for (int e=0; e<n_active; e++) {
+        if (res_norm[e] < this->tol) {
+          this->iterations[member[e]] = iter[e];
+          n_converged++;
+          member[e] = -1;
+        }
+        else if (iter[e] == this->max_iter || !(res_norm[e] < 1e100))
+          member[e] = -1;   // not converged or diverged
+        else {
+          for (int i=0; i<n_dof; i++) y_lane[e][i] += dy_lane[e][i];
+          iter[e]++;
+        }
+      }
+    }
+    for (int e=0; e<W; e++) delete [] dy_lane[e];
+  }
+  return n_converged;
+}
@@ -0,0 +1,85 @@
+#ifndef _ENSEMBLE_H_
+#define _ENSEMBLE_H_
+
+#include <vector>
+
+#include "discrete.h"
+
+/// Registers the weak forms of one member of an ensemble in 'dp', with the
+/// parameters 'params' of the member (usually passed on to the forms as
+/// their user_data).
+typedef void (*ensemble_setup)(DiscreteProblem *dp, void *params);
+
+/// Registers the batched forms (see DiscreteProblem::add_matrix_form_batch())
+/// of BATCH_WIDTH members solved in lockstep. 'lane_params' is an array of
+/// BATCH_WIDTH parameter pointers which has to be the user_data of all
+/// forms: lane e of the batched forms and the surface forms of lane e
+/// belong to the member with the parameters lane_params[e]. The entries
+/// change while the ensemble is solved, so the forms must read them on
+/// every call.
+typedef void (*ensemble_setup_batch)(DiscreteProblem *dp, void **lane_params);
+
+/// \brief Concurrent solution of many problems differing only in parameters.
+///
+/// All members of the ensemble live on the same mesh and have the forms
+/// registered by the same setup function, called with the parameters of the
+/// member. solve() distributes the members over the OpenMP threads; every
+/// member is solved by Newton's method with a FrontalSolver, so no global
+/// matrix is assembled or factorized. The mesh, the quadrature and basis
+/// tables and a GeometryCache of the mesh are shared by all threads and
+/// only read. Every member has its own DiscreteProblem, so the forms must
+/// not use global variables.
+///
+/// With an ensemble_setup_batch function, every thread solves BATCH_WIDTH
+/// members in lockstep with a FrontalSolverBatch instead, so that the forms
+/// and the elimination run over the members in the vector lanes. A lane
+/// whose member has converged is refilled with the next member right away,
+/// which keeps the lanes busy although the members need different numbers
+/// of Newton iterations.
+///
+/// The Dirichlet values are those of the shared mesh. Boundary values which
+/// vary within the ensemble have to be imposed by surface forms.
+class EnsembleSolver {
+public:
+    EnsembleSolver(Mesh *mesh, ensemble_setup setup, double tol=1e-8,
+                   int max_iter=50);
+    EnsembleSolver(Mesh *mesh, ensemble_setup_batch setup, double tol=1e-8,
+                   int max_iter=50);
+
+    /// Solves the n members with the parameters params[0..n-1]. The
+    /// solution of the k-th member is stored at y + k*n_dof, n_dof being
+    /// the number of dofs of the mesh. Newton's method starts from y_init,
+    /// or from zero if it is NULL, and stops when the L2 norm of the
+    /// residual is below tol, or early when it is no longer below 1e100
+    /// (diverged). Returns the number of converged members.
+    int solve(int n, void **params, double *y, double *y_init=NULL);
+
+    /// Newton iterations of the k-th member in the last solve(), -1 if
+    /// the member did not converge.
+    int get_iterations(int k) {
+        return this->iterations[k];
+    }
+    /// Wall time of the last solve() (in seconds).
+    double get_time() {
+        return this->time;
+    }
+    /// Throughput of the last solve().
+    double get_solves_per_second() {
+        return this->time > 0 ? this->iterations.size() / this->time : 0;
+    }
+
+private:
+    Mesh *mesh;
+    ensemble_setup setup;
+    ensemble_setup_batch setup_batch;
+    double tol;
+    int max_iter;
+    GeometryCache geom_cache;
+    std::vector<int> iterations;
+    double time;
+
+    int solve_single(int n, void **params, double *y, double *y_init);
+    int solve_lockstep(int n, void **params, double *y, double *y_init);
+};
+
+#endif
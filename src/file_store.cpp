@@ -0,0 +1,192 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <algorithm>
+
+#include "file_store.h"
+
+// granularity of the read-ahead and write-back (in values)
+#define STORE_CHUNK (1 << 20)
+
+// open 'filename', or an anonymous temporary file if it is NULL
+static int open_store_file(const char *filename)
+{
+  int fd;
+  if (filename != NULL)
+    fd = open(filename, O_RDWR | O_CREAT, 0644);
+  else {
+    const char *dir = getenv("TMPDIR");
+    if (dir == NULL) dir = "/tmp";
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/hermes1d-XXXXXX", dir);
+    fd = mkstemp(path);
+    if (fd != -1) unlink(path);
+  }
+  if (fd == -1) error("Cannot open the file for the out-of-core storage.");
+  return fd;
+}
+
+static double *map_store_file(int fd, size_t n)
+{
+  if (ftruncate(fd, n*sizeof(double)) != 0)
+    error("Cannot resize the file for the out-of-core storage.");
+  if (n == 0) return NULL;
+  void *p = mmap(NULL, n*sizeof(double), PROT_READ | PROT_WRITE, MAP_SHARED,
+                 fd, 0);
+  if (p == MAP_FAILED) error("Cannot map the file for the out-of-core storage.");
+  return (double *) p;
+}
+
+// madvise() on the values first...first+n-1 of the mapping 'data' with
+// 'size' values. MADV_WILLNEED extends the range to page boundaries;
+// MADV_DONTNEED shrinks it to the pages lying completely inside, since
+// the values next to the range may still be in use.
+static void advise(double *data, size_t size, size_t first, size_t n,
+                   int advice)
+{
+  if (data == NULL || first >= size) return;
+  n = std::min(n, size - first);
+  if (n == 0) return;
+  size_t page = sysconf(_SC_PAGESIZE);
+  size_t begin = first*sizeof(double);
+  size_t end = (first + n)*sizeof(double);
+  char *base = (char *) data;
+  if (advice == MADV_DONTNEED) {
+    begin = (begin + page - 1) / page * page;
+    end = end / page * page;
+    if (end <= begin) return;
+    msync(base + begin, end - begin, MS_ASYNC);
+  }
+  else {
+    begin = begin / page * page;
+    end = (end + page - 1) / page * page;
+  }
+  madvise(base + begin, end - begin, advice);
+}
+
+//// MappedVector //////////////////////////////////////////////////////////////
+
+MappedVector::MappedVector(int n, const char *filename)
+{
+  this->fd = open_store_file(filename);
+  this->size = n;
+  this->data = map_store_file(this->fd, n);
+}
+
+MappedVector::~MappedVector()
+{
+  if (this->data != NULL) munmap(this->data, this->size*sizeof(double));
+  close(this->fd);
+}
+
+void MappedVector::prefetch(int first, int n)
+{
+  advise(this->data, this->size, first, n, MADV_WILLNEED);
+}
+
+void MappedVector::release(int first, int n)
+{
+  advise(this->data, this->size, first, n, MADV_DONTNEED);
+}
+
+// The vertex dofs and the bubble dofs of a range of elements form two
+// contiguous ranges of the coefficient vector (see Mesh::assign_dofs()).
+void MappedVector::advise_elems(Mesh *mesh, int first, int last, bool need)
+{
+  Element *elems = mesh->get_elems();
+  first = std::max(first, 0);
+  last = std::min(last, mesh->get_n_elems()-1);
+  int v_min = -1, v_max = -1, b_min = -1, b_max = -1;
+  for (int m=first; m<=last; m++) {
+    for (int j=0; j<=elems[m].p; j++) {
+      int d = elems[m].dof[j];
+      if (d == -1) continue;
+      int &lo = j < 2 ? v_min : b_min;
+      int &hi = j < 2 ? v_max : b_max;
+      if (lo == -1 || d < lo) lo = d;
+      if (d > hi) hi = d;
+    }
+  }
+  if (v_min != -1) {
+    if (need) this->prefetch(v_min, v_max - v_min + 1);
+    else this->release(v_min, v_max - v_min + 1);
+  }
+  if (b_min != -1) {
+    if (need) this->prefetch(b_min, b_max - b_min + 1);
+    else this->release(b_min, b_max - b_min + 1);
+  }
+}
+
+void MappedVector::prefetch_elems(Mesh *mesh, int first, int last)
+{
+  this->advise_elems(mesh, first, last, true);
+}
+
+void MappedVector::release_elems(Mesh *mesh, int first, int last)
+{
+  this->advise_elems(mesh, first, last, false);
+}
+
+//// FileFactorStore ///////////////////////////////////////////////////////////
+
+FileFactorStore::FileFactorStore(const char *filename)
+{
+  this->fd = open_store_file(filename);
+  this->data = NULL;
+  this->size = 0;
+  this->capacity = 0;
+}
+
+FileFactorStore::~FileFactorStore()
+{
+  if (this->data != NULL) munmap(this->data, this->capacity*sizeof(double));
+  close(this->fd);
+}
+
+void FileFactorStore::reserve(size_t n)
+{
+  if (n <= this->capacity) return;
+  size_t cap = std::max(std::max(2*this->capacity, n), (size_t) STORE_CHUNK);
+  if (this->data != NULL) munmap(this->data, this->capacity*sizeof(double));
+  this->data = map_store_file(this->fd, cap);
+  this->capacity = cap;
+  // only the chunk being written needs to be mapped
+  size_t chunk = this->size / STORE_CHUNK * STORE_CHUNK;
+  advise(this->data, this->capacity, 0, chunk, MADV_DONTNEED);
+}
+
+void FileFactorStore::clear()
+{
+  this->size = 0;
+}
+
+void FileFactorStore::push(double *data, int n)
+{
+  this->reserve(this->size + n);
+  memcpy(this->data + this->size, data, n*sizeof(double));
+  size_t old_chunk = this->size / STORE_CHUNK;
+  this->size += n;
+  size_t new_chunk = this->size / STORE_CHUNK;
+  // flush the chunks which have been completed
+  if (new_chunk > old_chunk)
+    advise(this->data, this->capacity, old_chunk*STORE_CHUNK,
+           (new_chunk - old_chunk)*STORE_CHUNK, MADV_DONTNEED);
+}
+
+void FileFactorStore::pop(double *data, int n)
+{
+  if (this->size < (size_t) n) error("FactorStore: not enough data.");
+  if (n == 0) return;
+  size_t old_chunk = (this->size - 1) / STORE_CHUNK;
+  this->size -= n;
+  memcpy(data, this->data + this->size, n*sizeof(double));
+  size_t new_chunk = this->size / STORE_CHUNK;
+  if (new_chunk < old_chunk) {
+    // drop the chunks that have been consumed, read ahead the next one
+    advise(this->data, this->capacity, (new_chunk + 1)*STORE_CHUNK,
+           (old_chunk - new_chunk)*STORE_CHUNK, MADV_DONTNEED);
+    if (new_chunk > 0)
+      advise(this->data, this->capacity, (new_chunk - 1)*STORE_CHUNK,
+             STORE_CHUNK, MADV_WILLNEED);
+  }
+}
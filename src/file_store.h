@@ -0,0 +1,79 @@
+#ifndef _FILE_STORE_H_
+#define _FILE_STORE_H_
+
+#include <sys/types.h>
+
+#include "mesh.h"
+#include "frontal.h"
+
+/// \brief Vector of doubles stored in a memory-mapped file.
+///
+/// MappedVector is meant for coefficient vectors that do not fit into
+/// memory. get_data() returns an ordinary pointer that can be passed to any
+/// function taking a coefficient vector, the operating system pages the
+/// data in and out as needed. Code that walks the vector sequentially can
+/// additionally call prefetch() for the part it will need next, which starts
+/// an asynchronous read-ahead overlapping the computation, and release() for
+/// the part it is done with, which starts the write-back and drops the pages
+/// from the address space.
+///
+/// If no file name is given, an anonymous temporary file in $TMPDIR (or
+/// /tmp) is used, otherwise the given file is created or reused, so that
+/// the solution is kept after the program ends.
+class MappedVector {
+public:
+    MappedVector(int n, const char *filename=NULL);
+    ~MappedVector();
+
+    double *get_data() {
+        return this->data;
+    }
+    int get_size() {
+        return this->size;
+    }
+
+    /// Read-ahead hint for the entries first...first+n-1.
+    void prefetch(int first, int n);
+    /// The entries first...first+n-1 will not be needed soon (only the
+    /// pages lying completely inside the range are released).
+    void release(int first, int n);
+
+    /// prefetch() / release() for all dofs of the elements first...last
+    /// of 'mesh'.
+    void prefetch_elems(Mesh *mesh, int first, int last);
+    void release_elems(Mesh *mesh, int first, int last);
+
+private:
+    int fd;
+    int size;
+    double *data;
+
+    void advise_elems(Mesh *mesh, int first, int last, bool need);
+};
+
+/// \brief FactorStore in a memory-mapped file.
+///
+/// The factors of FrontalSolver are written to a (temporary) file which
+/// grows as needed. Since the factors are written and read strictly
+/// sequentially, only the chunk currently being accessed is kept mapped:
+/// written chunks are flushed and dropped, and during the back substitution
+/// the preceding chunk is prefetched while the current one is read.
+class FileFactorStore : public FactorStore {
+public:
+    FileFactorStore(const char *filename=NULL);
+    virtual ~FileFactorStore();
+
+    virtual void clear();
+    virtual void push(double *data, int n);
+    virtual void pop(double *data, int n);
+
+private:
+    int fd;
+    double *data;
+    size_t size;       // number of stored values
+    size_t capacity;   // size of the file (in values)
+
+    void reserve(size_t n);
+};
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef _FORM_UTILS_H_
+#define _FORM_UTILS_H_
+
+/// \file form_utils.h
+/// \brief Quadrature buffer layout and helper reductions for weak forms.
+///
+/// All arrays passed to the volumetric weak forms (x, weights, u, dudx, v,
+/// dvdx, u_prev, du_prevdx) satisfy:
+///
+///   - they are aligned to QUAD_ALIGN bytes,
+///   - they have at least quad_padded(num) entries, num being the number
+///     of quadrature points,
+///   - the entries num...quad_padded(num)-1 are padding: the weights are
+///     zero, x repeats the last quadrature point and all other arrays are
+///     zero.
+///
+/// A form may therefore sum over quad_padded(num) points instead of num,
+/// so that the loop has no remainder, as long as the summand is finite at
+/// the padding points (it is multiplied by a zero weight). The helpers
+/// below do exactly that.
+
+/// Alignment of the quadrature buffers (in bytes).
+#define QUAD_ALIGN 64
+/// The buffer lengths are multiples of QUAD_PAD values.
+#define QUAD_PAD 8
+/// Maximum padded number of quadrature points.
+#define QUAD_MAX_PTS 104
+
+#if defined(__GNUC__)
+#define QUAD_ALIGNED __attribute__((aligned(QUAD_ALIGN)))
+#define QUAD_ASSUME_ALIGNED(p) \
+    ((const double *) __builtin_assume_aligned((p), QUAD_ALIGN))
+#else
+#define QUAD_ALIGNED
+#define QUAD_ASSUME_ALIGNED(p) ((const double *) (p))
+#endif
+
+/// \brief Batched forms.
+///
+/// The batched volumetric forms (see DiscreteProblem::add_matrix_form_batch())
+/// are evaluated for BATCH_WIDTH elements of the same degree at once. Their
+/// arrays are stored point-major, element-minor: a[k*BATCH_WIDTH + e] is the
+/// value at the k-th quadrature point of the e-th element of the batch, so
+/// that the inner loop over e runs at full vector width however few
+/// quadrature points there are. The arrays are aligned to QUAD_ALIGN bytes.
+/// If the batch is not full, the unused lanes repeat the data of a used one
+/// with zero weights; their results are ignored.
+#define BATCH_WIDTH 8
+
+/// Number of quadrature points rounded up to a multiple of QUAD_PAD.
+inline int quad_padded(int num)
+{
+    return (num + QUAD_PAD - 1) / QUAD_PAD * QUAD_PAD;
+}
+
+/// Returns sum_i w[i]*a[i].
+inline double quad_dot(int num, const double *w, const double *a)
+{
+    const double *w_ = QUAD_ASSUME_ALIGNED(w);
+    const double *a_ = QUAD_ASSUME_ALIGNED(a);
+    int n = quad_padded(num);
+    double val = 0;
+    #pragma omp simd reduction(+:val)
+    for (int i = 0; i < n; i++)
+        val += w_[i]*a_[i];
+    return val;
+}
+
+/// Returns sum_i w[i]*a[i]*b[i].
+inline double quad_dot(int num, const double *w, const double *a,
+                       const double *b)
+{
+    const double *w_ = QUAD_ASSUME_ALIGNED(w);
+    const double *a_ = QUAD_ASSUME_ALIGNED(a);
+    const double *b_ = QUAD_ASSUME_ALIGNED(b);
+    int n = quad_padded(num);
+    double val = 0;
+    #pragma omp simd reduction(+:val)
+    for (int i = 0; i < n; i++)
+        val += w_[i]*a_[i]*b_[i];
+    return val;
+}
+
+/// Returns sum_i w[i]*a[i]*b[i]*c[i].
+inline double quad_dot(int num, const double *w, const double *a,
+                       const double *b, const double *c)
+{
+    const double *w_ = QUAD_ASSUME_ALIGNED(w);
+    const double *a_ = QUAD_ASSUME_ALIGNED(a);
+    const double *b_ = QUAD_ASSUME_ALIGNED(b);
+    const double *c_ = QUAD_ASSUME_ALIGNED(c);
+    int n = quad_padded(num);
+    double val = 0;
+    #pragma omp simd reduction(+:val)
+    for (int i = 0; i < n; i++)
+        val += w_[i]*a_[i]*b_[i]*c_[i];
+    return val;
+}
+
+/// Returns sum_i w[i]*(alpha*a[i]*b[i] + beta*c[i]*d[i]), e.g. the
+/// stiffness plus mass term alpha*u'v' + beta*uv in one pass.
+inline double quad_dot_sum(int num, const double *w, double alpha,
+                           const double *a, const double *b, double beta,
+                           const double *c, const double *d)
+{
+    const double *w_ = QUAD_ASSUME_ALIGNED(w);
+    const double *a_ = QUAD_ASSUME_ALIGNED(a);
+    const double *b_ = QUAD_ASSUME_ALIGNED(b);
+    const double *c_ = QUAD_ASSUME_ALIGNED(c);
+    const double *d_ = QUAD_ASSUME_ALIGNED(d);
+    int n = quad_padded(num);
+    double val = 0;
+    #pragma omp simd reduction(+:val)
+    for (int i = 0; i < n; i++)
+        val += w_[i]*(alpha*a_[i]*b_[i] + beta*c_[i]*d_[i]);
+    return val;
+}
+
+/// Batched quad_dot(): result[e] = sum_k w[k,e]*a[k,e]*b[k,e] for all
+/// lanes e of a batch with num quadrature points.
+inline void batch_dot(int num, const double *w, const double *a,
+                      const double *b, double *result)
+{
+    const double *w_ = QUAD_ASSUME_ALIGNED(w);
+    const double *a_ = QUAD_ASSUME_ALIGNED(a);
+    const double *b_ = QUAD_ASSUME_ALIGNED(b);
+    double acc[BATCH_WIDTH] QUAD_ALIGNED;
+    for (int e = 0; e < BATCH_WIDTH; e++) acc[e] = 0;
+    for (int k = 0; k < num; k++) {
+        #pragma omp simd
+        for (int e = 0; e < BATCH_WIDTH; e++)
+            acc[e] += w_[k*BATCH_WIDTH + e]*a_[k*BATCH_WIDTH + e]*
+                      b_[k*BATCH_WIDTH + e];
+    }
+    for (int e = 0; e < BATCH_WIDTH; e++) result[e] = acc[e];
+}
+
+/// Batched quad_dot_sum(): result[e] = sum_k w*(alpha*a*b + beta*c*d).
+inline void batch_dot_sum(int num, const double *w, double alpha,
+                          const double *a, const double *b, double beta,
+                          const double *c, const double *d, double *result)
+{
+    const double *w_ = QUAD_ASSUME_ALIGNED(w);
+    const double *a_ = QUAD_ASSUME_ALIGNED(a);
+    const double *b_ = QUAD_ASSUME_ALIGNED(b);
+    const double *c_ = QUAD_ASSUME_ALIGNED(c);
+    const double *d_ = QUAD_ASSUME_ALIGNED(d);
+    double acc[BATCH_WIDTH] QUAD_ALIGNED;
+    for (int e = 0; e < BATCH_WIDTH; e++) acc[e] = 0;
+    for (int k = 0; k < num; k++) {
+        #pragma omp simd
+        for (int e = 0; e < BATCH_WIDTH; e++) {
+            int l = k*BATCH_WIDTH + e;
+            acc[e] += w_[l]*(alpha*a_[l]*b_[l] + beta*c_[l]*d_[l]);
+        }
+    }
+    for (int e = 0; e < BATCH_WIDTH; e++) result[e] = acc[e];
+}
+
+#endif
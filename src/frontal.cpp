@@ -0,0 +1,339 @@
+#include "frontal.h"
+#include "file_store.h"
+
+// number of elements between read-ahead hints for out-of-core vectors
+#define FRONTAL_CHUNK 4096
+
+FrontalSolver::FrontalSolver(DiscreteProblem *dp, FactorStore *store)
+{
+    this->dp = dp;
+    this->own_store = (store == NULL);
+    if (store == NULL) store = new MemoryFactorStore();
+    this->store = store;
+}
+
+FrontalSolver::~FrontalSolver()
+{
+    if (this->own_store) delete this->store;
+}
+
+// see FrontalSolver::get_local_unknowns()
+static int local_unknowns(Mesh *mesh, int m, int *idx, int *n_kept)
+{
+    Element *e = mesh->get_elems() + m;
+    bool last = (m == mesh->get_n_elems()-1);
+    int n = 0;
+    if (e->dof[0] != -1) idx[n++] = 0;     // left vertex
+    for (int j=2; j<=e->p; j++) idx[n++] = j; // bubbles
+    *n_kept = 0;
+    if (e->dof[1] != -1) {                 // right vertex
+        idx[n++] = 1;
+        if (!last) *n_kept = 1;
+    }
+    return n;
+}
+
+int FrontalSolver::get_local_unknowns(int m, int *idx, int *n_kept)
+{
+    return local_unknowns(this->dp->get_mesh(), m, idx, n_kept);
+}
+
+// The elimination kernels below are shared by FrontalSolver (W = 1) and
+// FrontalSolverBatch (W = BATCH_WIDTH). All arrays are interleaved: entry r
+// of lane e is stored at r*W + e, so that every step runs over all lanes.
+
+// Builds the local system of an element in the eliminated-first ordering
+// 'idx' (n unknowns, the first n_elim of which are eliminated) from the
+// local matrices lane_mat[e] and vectors lane_res[e] (n_loc = p+1). Row r
+// belongs to the first index of the global matrix, mat(dof[r], dof[c]).
+// Unless 'first', the left vertex receives the Schur complement carried
+// over from the previous element. The squares of the completed residual
+// entries are added to 'norm'; the interface entry, which is completed by
+// the next element, is kept in 'front_res'.
+template<int W>
+static void build_front(int n, int n_elim, int *idx, int n_loc,
+        double **lane_mat, double **lane_res, bool first, double *a,
+        double *b, double *front_diag, double *front_rhs, double *front_res,
+        double *norm)
+{
+    for (int r=0; r<n; r++) {
+        for (int e=0; e<W; e++) {
+            double *lm = lane_mat[e];
+            for (int c=0; c<n; c++)
+                a[(r*n + c)*W + e] = lm[idx[r]*n_loc + idx[c]];
+            double res_r = lane_res[e][idx[r]];
+            b[r*W + e] = -res_r;
+            if (!first && idx[r] == 0) {
+                a[(r*n + r)*W + e] += front_diag[e];
+                b[r*W + e] += front_rhs[e];
+                res_r += front_res[e];
+            }
+            if (r < n_elim) norm[e] += res_r*res_r;
+            else front_res[e] = res_r;
+        }
+    }
+}
+
+// Gaussian elimination of the first n_elim unknowns with partial pivoting
+// (per lane) among the fully assembled rows; the interface row receives
+// the Schur complement, which is returned in front_diag and front_rhs.
+// Then the back substitution within the element: on return, b holds
+// y = A_EE^{-1} b_E and x holds Z = A_EE^{-1} A_Ek (zero if n_kept is 0).
+template<int W>
+static void eliminate_front(int n, int n_elim, int n_kept, double *a,
+        double *b, double *x, double *front_diag, double *front_rhs)
+{
+    for (int c=0; c<n_elim; c++) {
+        for (int e=0; e<W; e++) {
+            int p = c;
+            for (int r=c+1; r<n_elim; r++)
+                if (fabs(a[(r*n + c)*W + e]) > fabs(a[(p*n + c)*W + e]))
+                    p = r;
+            if (a[(p*n + c)*W + e] == 0.0) error("Singular matrix!");
+            if (p != c) {
+                for (int k=c; k<n; k++)
+                    std::swap(a[(c*n + k)*W + e], a[(p*n + k)*W + e]);
+                std::swap(b[c*W + e], b[p*W + e]);
+            }
+        }
+        for (int r=c+1; r<n; r++) {
+            double l[W];
+            #pragma omp simd
+            for (int e=0; e<W; e++)
+                l[e] = a[(r*n + c)*W + e] / a[(c*n + c)*W + e];
+            if (W == 1 && l[0] == 0.0) continue;
+            for (int k=c+1; k<n; k++) {
+                #pragma omp simd
+                for (int e=0; e<W; e++)
+                    a[(r*n + k)*W + e] -= l[e] * a[(c*n + k)*W + e];
+            }
+            #pragma omp simd
+            for (int e=0; e<W; e++) b[r*W + e] -= l[e] * b[c*W + e];
+        }
+    }
+    if (n_kept) {
+        for (int e=0; e<W; e++) {
+            front_diag[e] = a[(n_elim*n + n_elim)*W + e];
+            front_rhs[e] = b[n_elim*W + e];
+        }
+    }
+
+    for (int r=n_elim-1; r>=0; r--) {
+        for (int k=r+1; k<n_elim; k++) {
+            #pragma omp simd
+            for (int e=0; e<W; e++) {
+                b[r*W + e] -= a[(r*n + k)*W + e] * b[k*W + e];
+                if (n_kept)
+                    a[(r*n + n_elim)*W + e] -= a[(r*n + k)*W + e] *
+                                               a[(k*n + n_elim)*W + e];
+            }
+        }
+        #pragma omp simd
+        for (int e=0; e<W; e++) {
+            b[r*W + e] /= a[(r*n + r)*W + e];
+            if (n_kept) a[(r*n + n_elim)*W + e] /= a[(r*n + r)*W + e];
+        }
+    }
+    for (int r=0; r<n_elim; r++)
+        for (int e=0; e<W; e++)
+            x[r*W + e] = n_kept ? a[(r*n + n_elim)*W + e] : 0;
+}
+
+// Recovers the eliminated unknowns x_E = y - Z x_k of element 'e' for the
+// lanes 0..n_lanes-1 from the stored y (in b) and Z (in x); the interface
+// unknown x_k is already known in dy[l].
+template<int W>
+static void back_substitute(Element *elem, int n_elim, int n_kept, int *idx,
+        double *b, double *x, double **dy, int n_lanes)
+{
+    for (int e=0; e<n_lanes; e++) {
+        double x_k = n_kept ? dy[e][elem->dof[1]] : 0;
+        for (int r=0; r<n_elim; r++)
+            dy[e][elem->dof[idx[r]]] = b[r*W + e] -
+                                       (n_kept ? x[r*W + e]*x_k : 0);
+    }
+}
+
+double FrontalSolver::solve(double *y_prev, double *dy)
+{
+    return this->solve(y_prev, dy, NULL, NULL);
+}
+
+double FrontalSolver::solve(MappedVector *y_prev, MappedVector *dy)
+{
+    return this->solve(y_prev->get_data(), dy->get_data(), y_prev, dy);
+}
+
+double FrontalSolver::solve(double *y_prev, double *dy,
+        MappedVector *y_prev_map, MappedVector *dy_map)
+{
+    Mesh *mesh = this->dp->get_mesh();
+    Element *elems = mesh->get_elems();
+    int n_elem = mesh->get_n_elems();
+    int n_max = mesh->get_max_poly_order() + 1;
+
+    double *local_mat = new double[n_max*n_max];
+    double *local_res = new double[n_max];
+    double *surf_mat = new double[n_max*n_max];
+    double *surf_res = new double[n_max];
+    double *a = new double[n_max*n_max];  // front matrix
+    double *b = new double[n_max];        // front right-hand side
+    double *x = new double[n_max];
+    int *idx = new int[n_max];
+
+    // Schur complement and raw residual carried over to the next element
+    double front_diag = 0, front_rhs = 0, front_res = 0;
+    double res_norm = 0;
+
+    // forward sweep: assemble and eliminate
+    this->store->clear();
+    for (int m=0; m<n_elem; m++) {
+        if (y_prev_map != NULL && m % FRONTAL_CHUNK == 0) {
+            y_prev_map->prefetch_elems(mesh, m == 0 ? 0 : m + FRONTAL_CHUNK,
+                                       m + 2*FRONTAL_CHUNK - 1);
+            if (m > 0) y_prev_map->release_elems(mesh, m - FRONTAL_CHUNK, m-1);
+        }
+        int n_loc = elems[m].p + 1;
+        this->dp->element_vol_forms(m, y_prev, local_mat, local_res, 0);
+        for (int bdy=0; bdy<2; bdy++) {
+            int bdy_index = bdy == 0 ? BOUNDARY_LEFT : BOUNDARY_RIGHT;
+            int bdy_elem = bdy == 0 ? 0 : n_elem-1;
+            int *bc_dir = bdy == 0 ? mesh->bc_left_dir : mesh->bc_right_dir;
+            if (m != bdy_elem || bc_dir[0] == 1) continue;
+            this->dp->element_surf_forms(bdy_index, y_prev, surf_mat, surf_res, 0);
+            for (int i=0; i<n_loc*n_loc; i++) local_mat[i] += surf_mat[i];
+            for (int i=0; i<n_loc; i++) local_res[i] += surf_res[i];
+        }
+
+        int n_kept;
+        int n = this->get_local_unknowns(m, idx, &n_kept);
+        int n_elim = n - n_kept;
+        build_front<1>(n, n_elim, idx, n_loc, &local_mat, &local_res, m == 0,
+                       a, b, &front_diag, &front_rhs, &front_res, &res_norm);
+        eliminate_front<1>(n, n_elim, n_kept, a, b, x, &front_diag,
+                           &front_rhs);
+        this->store->push(b, n_elim);
+        if (n_kept) this->store->push(x, n_elim);
+    }
+
+    // back substitution from right to left
+    for (int m=n_elem-1; m>=0; m--) {
+        if (dy_map != NULL && (m == n_elem-1 || (m+1) % FRONTAL_CHUNK == 0)) {
+            dy_map->prefetch_elems(mesh, m - 2*FRONTAL_CHUNK + 1,
+                                   m == n_elem-1 ? m : m - FRONTAL_CHUNK);
+            if (m < n_elem-1)
+                dy_map->release_elems(mesh, m+1, m + FRONTAL_CHUNK);
+        }
+        int n_kept;
+        int n = this->get_local_unknowns(m, idx, &n_kept);
+        int n_elim = n - n_kept;
+        if (n_kept) this->store->pop(x, n_elim);
+        this->store->pop(b, n_elim);
+        back_substitute<1>(elems + m, n_elim, n_kept, idx, b, x, &dy, 1);
+    }
+
+    delete [] local_mat;
+    delete [] local_res;
+    delete [] surf_mat;
+    delete [] surf_res;
+    delete [] a;
+    delete [] b;
+    delete [] x;
+    delete [] idx;
+
+    return sqrt(res_norm);
+}
+
+FrontalSolverBatch::FrontalSolverBatch(DiscreteProblem *dp)
+{
+    // the other volumetric forms would not be evaluated
+    if (!dp->use_batch_forms())
+        error("FrontalSolverBatch: the problem has no batched forms.");
+    this->dp = dp;
+}
+
+// Same algorithm as FrontalSolver::solve(), with the kernels instantiated
+// for W = BATCH_WIDTH lanes. Lanes e >= n repeat the last problem, so that
+// all loops run over the full width.
+void FrontalSolverBatch::solve(int n_lanes, double **y_prev, double **dy,
+                               double *res_norm)
+{
+    const int W = BATCH_WIDTH;
+    if (n_lanes < 1 || n_lanes > W) error("Invalid number of lanes.");
+    Mesh *mesh = this->dp->get_mesh();
+    Element *elems = mesh->get_elems();
+    int n_elem = mesh->get_n_elems();
+    int n_max = mesh->get_max_poly_order() + 1;
+
+    double *local_mat = new double[W*n_max*n_max];
+    double *local_res = new double[W*n_max];
+    double *surf_mat = new double[n_max*n_max];
+    double *surf_res = new double[n_max];
+    double *a = new double[n_max*n_max*W];  // front matrices
+    double *b = new double[n_max*W];        // front right-hand sides
+    double *x = new double[n_max*W];
+    int *idx = new int[n_max];
+
+    double front_diag[W], front_rhs[W], front_res[W], norm[W];
+    for (int e=0; e<W; e++) front_diag[e] = front_rhs[e] = front_res[e] =
+                            norm[e] = 0;
+
+    // forward sweep: assemble and eliminate
+    this->store.clear();
+    for (int m=0; m<n_elem; m++) {
+        int n_loc = elems[m].p + 1;
+        this->dp->element_vol_forms_lanes(m, n_lanes, y_prev, local_mat,
+                                          local_res, 0);
+        for (int bdy=0; bdy<2; bdy++) {
+            int bdy_index = bdy == 0 ? BOUNDARY_LEFT : BOUNDARY_RIGHT;
+            int bdy_elem = bdy == 0 ? 0 : n_elem-1;
+            int *bc_dir = bdy == 0 ? mesh->bc_left_dir : mesh->bc_right_dir;
+            if (m != bdy_elem || bc_dir[0] == 1) continue;
+            for (int e=0; e<n_lanes; e++) {
+                this->dp->element_surf_forms(bdy_index, y_prev[e], surf_mat,
+                                             surf_res, 0, e);
+                double *lm = local_mat + e*n_loc*n_loc;
+                double *lr = local_res + e*n_loc;
+                for (int i=0; i<n_loc*n_loc; i++) lm[i] += surf_mat[i];
+                for (int i=0; i<n_loc; i++) lr[i] += surf_res[i];
+            }
+        }
+
+        int n_kept;
+        int n = local_unknowns(mesh, m, idx, &n_kept);
+        int n_elim = n - n_kept;
+        // lanes e >= n_lanes repeat the last problem
+        double *lane_mat[W], *lane_res[W];
+        for (int e=0; e<W; e++) {
+            int l = e < n_lanes ? e : n_lanes-1;
+            lane_mat[e] = local_mat + l*n_loc*n_loc;
+            lane_res[e] = local_res + l*n_loc;
+        }
+        build_front<W>(n, n_elim, idx, n_loc, lane_mat, lane_res, m == 0, a,
+                       b, front_diag, front_rhs, front_res, norm);
+        eliminate_front<W>(n, n_elim, n_kept, a, b, x, front_diag,
+                           front_rhs);
+        this->store.push(b, n_elim*W);
+        if (n_kept) this->store.push(x, n_elim*W);
+    }
+
+    // back substitution from right to left
+    for (int m=n_elem-1; m>=0; m--) {
+        int n_kept;
+        int n = local_unknowns(mesh, m, idx, &n_kept);
+        int n_elim = n - n_kept;
+        if (n_kept) this->store.pop(x, n_elim*W);
+        this->store.pop(b, n_elim*W);
+        back_substitute<W>(elems + m, n_elim, n_kept, idx, b, x, dy, n_lanes);
+    }
+    for (int e=0; e<n_lanes; e++) res_norm[e] = sqrt(norm[e]);
+
+    delete [] local_mat;
+    delete [] local_res;
+    delete [] surf_mat;
+    delete [] surf_res;
+    delete [] a;
+    delete [] b;
+    delete [] x;
+    delete [] idx;
+}
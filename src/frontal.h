@@ -0,0 +1,119 @@
+#ifndef _FRONTAL_H_
+#define _FRONTAL_H_
+
+#include <vector>
+
+#include "discrete.h"
+
+class MappedVector;
+
+/// FactorStore is a sequential store for the factors produced by
+/// FrontalSolver. The factors are written element by element during the
+/// forward (elimination) sweep and read back in the reverse order during
+/// the back substitution, so the store behaves as a stack.
+class FactorStore {
+public:
+    virtual ~FactorStore() { }
+    /// Removes all data.
+    virtual void clear() = 0;
+    /// Appends n values.
+    virtual void push(double *data, int n) = 0;
+    /// Removes the last n values and copies them to 'data'.
+    virtual void pop(double *data, int n) = 0;
+};
+
+/// FactorStore keeping the factors in memory.
+class MemoryFactorStore : public FactorStore {
+public:
+    virtual void clear() {
+        this->data.clear();
+    }
+    virtual void push(double *data, int n) {
+        this->data.insert(this->data.end(), data, data + n);
+    }
+    virtual void pop(double *data, int n) {
+        if ((int) this->data.size() < n) error("FactorStore: not enough data.");
+        std::copy(this->data.end() - n, this->data.end(), data);
+        this->data.resize(this->data.size() - n);
+    }
+
+private:
+    std::vector<double> data;
+};
+
+/// \brief Frontal assembly and factorization of the Newton system.
+///
+/// Since a 1D mesh is a chain of elements, the Jacobi matrix and the residual
+/// can be assembled element by element from left to right, and all unknowns
+/// of an element except for the vertex shared with the next element can be
+/// eliminated as soon as the element has been assembled. The front therefore
+/// only consists of the current element plus one interface unknown, and the
+/// global matrix is never stored. For every element, the solver keeps
+///   y = A_EE^{-1} b_E,   Z = A_EE^{-1} A_Ek
+/// (E... eliminated unknowns, k... interface unknown) in a FactorStore, from
+/// which the solution is recovered by a right-to-left back substitution
+/// x_E = y - Z x_k.
+///
+/// The system solved is the one that DiscreteProblem::assemble_matrix_and_vector()
+/// followed by solve_linear_system() would solve, i.e. mat * dy = -res.
+class FrontalSolver {
+public:
+    /// If 'store' is NULL, the factors are kept in memory.
+    FrontalSolver(DiscreteProblem *dp, FactorStore *store=NULL);
+    ~FrontalSolver();
+
+    /// Performs one Newton step at 'y_prev': on return 'dy' holds the
+    /// solution of J(y_prev) dy = -res(y_prev). Returns the L2 norm of the
+    /// residual vector res(y_prev).
+    double solve(double *y_prev, double *dy);
+
+    /// Same for vectors stored out of core (see MappedVector); the elements
+    /// are processed in chunks, the data of the next chunk is read ahead
+    /// and the processed chunks are released. Combined with a
+    /// FileFactorStore, the memory used by the solver itself does not depend
+    /// on the number of elements.
+    double solve(MappedVector *y_prev, MappedVector *dy);
+
+private:
+    DiscreteProblem *dp;
+    FactorStore *store;
+    bool own_store;
+
+    double solve(double *y_prev, double *dy, MappedVector *y_prev_map,
+                 MappedVector *dy_map);
+
+    // local indices of the eliminated unknowns of element 'm' (followed by
+    // the interface unknown, if any); returns their total number and sets
+    // 'n_kept' to the number of interface unknowns
+    int get_local_unknowns(int m, int *idx, int *n_kept);
+};
+
+/// \brief Frontal solver for several problems in lockstep.
+///
+/// Solves the Newton systems of n <= BATCH_WIDTH problems which share the
+/// mesh and the forms and differ only in their parameters and solutions.
+/// Element by element, the batched forms (see
+/// DiscreteProblem::element_vol_forms_lanes()) are evaluated for all
+/// problems at once, problem e in lane e, and the local systems are
+/// eliminated as in FrontalSolver, stored interleaved so that every
+/// elimination step runs over all lanes (the pivot rows are chosen per
+/// lane). 'dp' must have batched volumetric forms only (the constructor
+/// calls error() otherwise, see DiscreteProblem::use_batch_forms()). The
+/// elimination kernels are the ones of FrontalSolver, instantiated for
+/// BATCH_WIDTH lanes. The user_data of its surface forms must be an array
+/// of BATCH_WIDTH pointers, the forms of lane e receive the e-th entry.
+class FrontalSolverBatch {
+public:
+    FrontalSolverBatch(DiscreteProblem *dp);
+
+    /// Performs one Newton step for each of the problems e < n: on return
+    /// dy[e] holds the solution of J(y_prev[e]) dy[e] = -res(y_prev[e])
+    /// and res_norm[e] the L2 norm of res(y_prev[e]).
+    void solve(int n, double **y_prev, double **dy, double *res_norm);
+
+private:
+    DiscreteProblem *dp;
+    MemoryFactorStore store;
+};
+
+#endif
@@ -13,5 +13,12 @@
 #include "quad_std.h"
 #include "lobatto.h"
 #include "discrete.h"
+#include "frontal.h"
+#include "file_store.h"
+#include "ensemble.h"
+#include "continuation.h"
+#include "projection.h"
+#include "sequencing.h"
+#include "norms.h"
 
 #endif
@@ -77,3 +77,51 @@ shape_fn_t legendre_der_tab_1d[] = {
 	legendre_der_0, legendre_der_1, legendre_der_2, legendre_der_3, legendre_der_4, legendre_der_5,
 	legendre_der_6, legendre_der_7, legendre_der_8, legendre_der_9, legendre_der_10, legendre_der_11
 };
+
+
+// number of points processed at once by lobatto_eval()
+#define LOBATTO_CHUNK 64
+
+void lobatto_eval(int p, int n_pts, const double *x, double *val, double *der)
+{
+  for (int i0 = 0; i0 < n_pts; i0 += LOBATTO_CHUNK) {
+    int n = n_pts - i0 < LOBATTO_CHUNK ? n_pts - i0 : LOBATTO_CHUNK;
+    const double *xc = x + i0;
+    // P_{k-2}, P_{k-1}, P_k at the points of this chunk
+    double buf[3][LOBATTO_CHUNK];
+    double *pk2 = buf[0], *pk1 = buf[1], *pk = buf[2];
+
+    for (int i = 0; i < n; i++) {
+      val[i0 + i] = l0(xc[i]);
+      if (der != NULL) der[i0 + i] = dl0(xc[i]);
+    }
+    if (p < 1) continue;
+    for (int i = 0; i < n; i++) {
+      val[n_pts + i0 + i] = l1(xc[i]);
+      if (der != NULL) der[n_pts + i0 + i] = dl1(xc[i]);
+      pk2[i] = 1.0;
+      pk1[i] = xc[i];
+    }
+
+    for (int k = 2; k <= p; k++) {
+      double c1 = (2.0*k - 1.0) / k;
+      double c2 = (k - 1.0) / k;
+      double s = 1.0 / sqrt(2.0*(2.0*k - 1.0));
+      double t = sqrt((2.0*k - 1.0) / 2.0);
+      double *val_k = val + k*n_pts + i0;
+      for (int i = 0; i < n; i++) {
+        pk[i] = c1 * xc[i] * pk1[i] - c2 * pk2[i];
+        val_k[i] = (pk[i] - pk2[i]) * s;
+      }
+      if (der != NULL) {
+        double *der_k = der + k*n_pts + i0;
+        for (int i = 0; i < n; i++)
+          der_k[i] = t * pk1[i];
+      }
+      double *tmp = pk2;
+      pk2 = pk1;
+      pk1 = pk;
+      pk = tmp;
+    }
+  }
+}
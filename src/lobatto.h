@@ -29,7 +29,7 @@
 #define phi6dx(x) (-1.0 / 32.0 * 2.73861278752583056728484891400 * (((2574.0*(x)*(x)-1980.0)*(x)*(x)+270.0)*(x)))
 #define phi7dx(x) (-1.0 / 32.0 * 2.91547594742265023543707643877 * (((5005.0*(x)*(x)-5005.0)*(x)*(x)+1155.0)*(x)*(x)-35.0))
 #define phi8dx(x) (-1.0 / 64.0 * 3.08220700148448822512509619073 * ((((19448.0*(x)*(x)-24024.0)*(x)*(x)+8008.0)*(x)*(x)-616.0)*(x)))
-#define phi9dx(x) (-1.0 / 64.0 * 24037034920393                  * ((((37791.0*(x)*(x)-55692.0)*(x)*(x)+24570.0)*(x)*(x)-3276.0)*(x)*(x)+63))
+#define phi9dx(x) (-1.0 / 64.0 * 3.24037034920393                * ((((37791.0*(x)*(x)-55692.0)*(x)*(x)+24570.0)*(x)*(x)-3276.0)*(x)*(x)+63))
 
 
 // Legendre polynomials
@@ -104,4 +104,14 @@ extern shape_fn_t legendre_der_tab_1d[];
 extern int lobatto_order_1d[];
 extern int legendre_order_1d[];
 
+/// Evaluates the Lobatto shape functions l_0, ..., l_p of any degree p and
+/// their derivatives at the points x[0], ..., x[n_pts-1] of the reference
+/// interval (-1, 1). The bubbles are computed from the three-term recurrence
+/// of the Legendre polynomials,
+///   l_k = (P_k - P_{k-2}) / sqrt(2(2k-1)),   l_k' = sqrt((2k-1)/2) P_{k-1},
+/// for all degrees in one pass over the points. On return
+/// val[k*n_pts + i] = l_k(x[i]) and der[k*n_pts + i] = l_k'(x[i]);
+/// 'der' can be NULL if the derivatives are not needed.
+void lobatto_eval(int p, int n_pts, const double *x, double *val, double *der);
+
 #endif /* SHAPESET_LOBATTO_H_ */
@@ -1,64 +1,101 @@
 #include "matrix.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #define TINY 1e-20
 
 
-void ludcmp(double** a, int n, int* indx, double* d)
+// Kernels of the dense LU decomposition. The rows of the matrices created
+// by new_matrix() are contiguous, so all inner loops run along rows; the
+// "omp simd" pragmas tell the compiler that the rows do not overlap.
+
+// y -= alpha*x
+static inline void lu_row_update(double *y, const double *x, double alpha,
+                                 int n)
 {
-  int i, imax = 0, j, k;
-  double big, dum, sum, temp;
-  double* vv = new double[n];
+  #pragma omp simd
+  for (int c = 0; c < n; c++)
+    y[c] -= alpha * x[c];
+}
+
+// y -= alpha[0]*x0 + alpha[1]*x1 + alpha[2]*x2 + alpha[3]*x3, which loads
+// and stores y only once for four rows of U
+static inline void lu_row_update4(double *y, const double *x0,
+        const double *x1, const double *x2, const double *x3,
+        const double *alpha, int n)
+{
+  double a0 = alpha[0], a1 = alpha[1], a2 = alpha[2], a3 = alpha[3];
+  #pragma omp simd
+  for (int c = 0; c < n; c++)
+    y[c] -= a0 * x0[c] + a1 * x1[c] + a2 * x2[c] + a3 * x3[c];
+}
 
+// block size of the LU decomposition (number of columns in a panel)
+#define LU_BLOCK 64
+// width of the column tiles in the trailing update
+#define LU_TILE 512
+
+// Blocked right-looking LU decomposition with partial pivoting. The
+// columns are processed in panels of LU_BLOCK columns: the panel is
+// factorized by the unblocked algorithm, then the corresponding block row
+// of U is computed and the trailing submatrix is updated by a rank-LU_BLOCK
+// product, which is where almost all of the work is done. The update is
+// tiled by columns so that the block row of U stays in cache, and its rows
+// are distributed among threads if OpenMP is enabled. Pivoting swaps the
+// row pointers, the permutation is returned in indx[] in the form used by
+// lubksb().
+void ludcmp(double** a, int n, int* indx, double* d)
+{
   *d = 1.0;
-  for (i = 0; i < n; i++)
-  {
-    big=0.0;
-    for (j = 0; j < n; j++) 
-      if ((temp = fabs(a[i][j])) > big) 
-        big = temp;
+  for (int i = 0; i < n; i++) {
+    double big = 0.0;
+    for (int j = 0; j < n; j++) big = std::max(big, fabs(a[i][j]));
     if (big == 0.0) error("Singular matrix!");
-    vv[i] = 1.0 / big;
   }
-  for (j = 0; j < n; j++)
-  {
-    for (i = 0; i < j; i++)
-    {
-      sum = a[i][j];
-      for (k = 0; k < i; k++) sum -= a[i][k]*a[k][j];
-      a[i][j] = sum;
-    }
-    big = 0.0;
-    for (i = j; i < n; i++)
-    {
-      sum = a[i][j];
-      for (k = 0; k < j; k++) sum -= a[i][k]*a[k][j];
-      a[i][j] = sum;
-      if ((dum = vv[i]*fabs(sum)) >= big)
-      {
-        big = dum;
-        imax = i;
+
+  for (int k0 = 0; k0 < n; k0 += LU_BLOCK) {
+    int k1 = std::min(k0 + LU_BLOCK, n);   // panel = columns k0...k1-1
+
+    // factorize the panel
+    for (int j = k0; j < k1; j++) {
+      int imax = j;
+      for (int i = j+1; i < n; i++)
+        if (fabs(a[i][j]) > fabs(a[imax][j])) imax = i;
+      if (imax != j) {
+        std::swap(a[imax], a[j]);
+        *d = -(*d);
       }
-    }
-    if (j != imax)
-    {
-      for (k = 0; k < n; k++)
-      {
-        dum = a[imax][k];
-        a[imax][k] = a[j][k];
-        a[j][k] = dum;
+      indx[j] = imax;
+      if (a[j][j] == 0.0) a[j][j] = TINY;
+      double dum = 1.0 / a[j][j];
+      for (int i = j+1; i < n; i++) {
+        double l_ij = (a[i][j] *= dum);
+        lu_row_update(a[i] + j+1, a[j] + j+1, l_ij, k1 - j-1);
       }
-      *d = -(*d);
-      vv[imax] = vv[j];
     }
-    indx[j] = imax;
-    if (a[j][j] == 0.0) a[j][j] = TINY;
-    if (j != n-1) 
-    {
-      dum = 1.0 / (a[j][j]);
-      for (i = j+1; i < n; i++) a[i][j] *= dum;
+    if (k1 == n) break;
+
+    // block row of U: U12 = L11^{-1} A12
+    for (int r = k0+1; r < k1; r++)
+      for (int k = k0; k < r; k++)
+        lu_row_update(a[r] + k1, a[k] + k1, a[r][k], n - k1);
+
+    // trailing update: A22 -= L21 U12
+    for (int c0 = k1; c0 < n; c0 += LU_TILE) {
+      int nc = std::min(LU_TILE, n - c0);
+      #pragma omp parallel for schedule(static) if ((n - k1)*nc > 65536)
+      for (int i = k1; i < n; i++) {
+        int k = k0;
+        for (; k + 4 <= k1; k += 4)
+          lu_row_update4(a[i] + c0, a[k] + c0, a[k+1] + c0, a[k+2] + c0,
+                         a[k+3] + c0, a[i] + k, nc);
+        for (; k < k1; k++)
+          lu_row_update(a[i] + c0, a[k] + c0, a[i][k], nc);
+      }
     }
   }
-  delete [] vv;
 }
 
 
@@ -87,14 +124,23 @@ void choldc(double **a, int n, double p[])
   }
 }
 
-void solve_linear_system_dense(DenseMatrix *mat, double *res)
+void DenseMatrix::factorize()
 {
-    int n = mat->get_size();
-    int *indx = new int[n];
-    double **_mat = mat->get_mat();
+    if (this->indx == NULL) this->indx = new int[this->size];
     double d;
-    ludcmp(_mat, n, indx, &d);
-    lubksb(_mat, n, indx, res);
+    ludcmp(this->mat, this->size, this->indx, &d);
+    this->factorized = true;
+}
+
+void DenseMatrix::solve(double *b)
+{
+    if (!this->factorized) this->factorize();
+    lubksb(this->mat, this->size, this->indx, b);
+}
+
+void solve_linear_system_dense(DenseMatrix *mat, double *res)
+{
+    mat->solve(res);
 }
 
 
@@ -102,4 +148,293 @@ void solve_linear_system(Matrix *mat, double *res)
 {
     DenseMatrix *dmat = new DenseMatrix(mat);
     solve_linear_system_dense(dmat, res);
+    delete dmat;
+}
+
+//// BlockTridiagMatrix ////////////////////////////////////////////////////////
+
+// Dense kernels for the small n x n row-major blocks of BlockTridiagMatrix.
+// For the common small block sizes the size is a template parameter, so the
+// loops are fully unrolled and the blocks are kept in registers; N = 0 is the
+// run-time sized fallback. The innermost loops always run over contiguous
+// rows so that they vectorize.
+
+// c -= a*b
+template<int N>
+static void block_gemm_sub(double *c, const double *a, const double *b, int n_)
+{
+  const int n = N ? N : n_;
+  for (int i = 0; i < n; i++)
+    for (int k = 0; k < n; k++) {
+      double a_ik = a[i*n + k];
+      for (int j = 0; j < n; j++)
+        c[i*n + j] -= a_ik * b[k*n + j];
+    }
+}
+
+// y -= a*x
+template<int N>
+static void block_gemv_sub(double *y, const double *a, const double *x, int n_)
+{
+  const int n = N ? N : n_;
+  for (int i = 0; i < n; i++) {
+    double sum = 0;
+    for (int j = 0; j < n; j++)
+      sum += a[i*n + j] * x[j];
+    y[i] -= sum;
+  }
+}
+
+// LU decomposition with partial pivoting of the block 'a' (in place)
+template<int N>
+static void block_lu(double *a, int *piv, int n_)
+{
+  const int n = N ? N : n_;
+  for (int k = 0; k < n; k++) {
+    int p = k;
+    for (int i = k+1; i < n; i++)
+      if (fabs(a[i*n + k]) > fabs(a[p*n + k])) p = i;
+    if (a[p*n + k] == 0.0) error("Singular matrix!");
+    piv[k] = p;
+    if (p != k)
+      for (int j = 0; j < n; j++) std::swap(a[k*n + j], a[p*n + j]);
+    double dum = 1.0 / a[k*n + k];
+    for (int i = k+1; i < n; i++) {
+      double l_ik = (a[i*n + k] *= dum);
+      for (int j = k+1; j < n; j++)
+        a[i*n + j] -= l_ik * a[k*n + j];
+    }
+  }
+}
+
+// solve a*x = b for 'm' right-hand sides stored as the columns of the
+// n x m row-major array 'b', using the factorization from block_lu()
+template<int N>
+static void block_lu_solve(const double *a, const int *piv, double *b, int m,
+        int n_)
+{
+  const int n = N ? N : n_;
+  for (int k = 0; k < n; k++)
+    if (piv[k] != k)
+      for (int j = 0; j < m; j++) std::swap(b[k*m + j], b[piv[k]*m + j]);
+  for (int i = 1; i < n; i++)
+    for (int k = 0; k < i; k++) {
+      double l_ik = a[i*n + k];
+      for (int j = 0; j < m; j++)
+        b[i*m + j] -= l_ik * b[k*m + j];
+    }
+  for (int i = n-1; i >= 0; i--) {
+    for (int k = i+1; k < n; k++) {
+      double u_ik = a[i*n + k];
+      for (int j = 0; j < m; j++)
+        b[i*m + j] -= u_ik * b[k*m + j];
+    }
+    double dum = 1.0 / a[i*n + i];
+    for (int j = 0; j < m; j++)
+      b[i*m + j] *= dum;
+  }
+}
+
+struct BlockKernels {
+  void (*gemm_sub)(double *c, const double *a, const double *b, int n);
+  void (*gemv_sub)(double *y, const double *a, const double *x, int n);
+  void (*lu)(double *a, int *piv, int n);
+  void (*lu_solve)(const double *a, const int *piv, double *b, int m, int n);
+};
+
+template<int N>
+static BlockKernels block_kernels()
+{
+  BlockKernels k = { block_gemm_sub<N>, block_gemv_sub<N>, block_lu<N>,
+                     block_lu_solve<N> };
+  return k;
+}
+
+static BlockKernels get_block_kernels(int n)
+{
+  switch (n) {
+    case 1: return block_kernels<1>();
+    case 2: return block_kernels<2>();
+    case 3: return block_kernels<3>();
+    case 4: return block_kernels<4>();
+    case 5: return block_kernels<5>();
+    case 6: return block_kernels<6>();
+    case 7: return block_kernels<7>();
+    case 8: return block_kernels<8>();
+    default: return block_kernels<0>();
+  }
+}
+
+// Blocked Thomas algorithm on the block rows first...last, ignoring the
+// coupling to the rest of the matrix. With D_i, L_i, U_i the diagonal, lower
+// and upper blocks of the i-th block row, the forward sweep computes
+//   D'_i = D_i - L_i X_{i-1},   X_i = D'_i^{-1} U_i,
+// storing the LU decomposition of D'_i in place of D_i and X_i in place
+// of U_i. The lower blocks are kept for the forward substitution.
+void BlockTridiagMatrix::factorize_range(int first, int last)
+{
+  int bs = this->block_size;
+  BlockKernels k = get_block_kernels(bs);
+  for (int i = first; i <= last; i++) {
+    double *d = this->get_block(i, 0);
+    if (i > first)
+      k.gemm_sub(d, this->get_block(i, -1), this->get_block(i-1, 1), bs);
+    k.lu(d, this->piv + i*bs, bs);
+    if (i < last)
+      k.lu_solve(d, this->piv + i*bs, this->get_block(i, 1), bs, bs);
+  }
+}
+
+void BlockTridiagMatrix::solve_range(int first, int last, double *b)
+{
+  int bs = this->block_size;
+  BlockKernels k = get_block_kernels(bs);
+  // forward substitution: y_i = D'_i^{-1} (b_i - L_i y_{i-1})
+  for (int i = first; i <= last; i++) {
+    double *b_i = b + (i-first)*bs;
+    if (i > first)
+      k.gemv_sub(b_i, this->get_block(i, -1), b_i - bs, bs);
+    k.lu_solve(this->get_block(i, 0), this->piv + i*bs, b_i, 1, bs);
+  }
+  // back substitution: x_i = y_i - X_i x_{i+1}
+  for (int i = last-1; i >= first; i--) {
+    double *b_i = b + (i-first)*bs;
+    k.gemv_sub(b_i, this->get_block(i, 1), b_i + bs, bs);
+  }
+}
+
+// Partitioned factorization. Let A_k be the diagonal part of the matrix
+// belonging to the k-th partition (block rows s_k...e_k), and let
+// t_k = x_{s_k}, u_k = x_{e_k} be its first and last unknowns. Then
+//   x_k = A_k^{-1} b_k - V_k u_{k-1} - W_k t_{k+1},
+// with the "spikes" V_k = A_k^{-1} [L_{s_k}; 0; ...] and
+// W_k = A_k^{-1} [...; 0; U_{e_k}]. Taking the first and last block of this
+// relation for every partition gives a block-tridiagonal system for the
+// pairs (t_k, u_k) with identity diagonal blocks, which is stored in
+// 'reduced'.
+void BlockTridiagMatrix::factorize(int n_parts)
+{
+  if (this->factorized) return;
+  int nb = this->n_blocks;
+  int bs = this->block_size;
+  // every partition needs at least two block rows
+  if (n_parts > nb/2) n_parts = nb/2;
+  if (n_parts < 1) n_parts = 1;
+  this->n_parts = n_parts;
+  delete [] this->part_first;
+  this->part_first = new int[n_parts+1];
+  for (int k = 0; k <= n_parts; k++)
+    this->part_first[k] = k*nb/n_parts;
+  delete this->reduced;
+  this->reduced = NULL;
+
+  if (n_parts == 1) {
+    this->factorize_range(0, nb-1);
+    this->factorized = true;
+    return;
+  }
+
+  int rs = 2*bs; // block size of the reduced system
+  this->reduced = new BlockTridiagMatrix(n_parts, rs);
+  #pragma omp parallel for schedule(static)
+  for (int k = 0; k < n_parts; k++) {
+    int first = this->part_first[k];
+    int last = this->part_first[k+1] - 1;
+    int n = (last - first + 1)*bs;
+    this->factorize_range(first, last);
+
+    double *d = this->reduced->get_block(k, 0);
+    for (int i = 0; i < rs; i++) d[i*rs + i] = 1.0;
+
+    // spikes, column by column: side 0 is V_k, side 1 is W_k
+    double *r = new double[n];
+    for (int side = 0; side < 2; side++) {
+      if (side == 0 && k == 0) continue;
+      if (side == 1 && k == n_parts-1) continue;
+      double *c = side == 0 ? this->get_block(first, -1)
+                            : this->get_block(last, 1);
+      double *dst = this->reduced->get_block(k, side == 0 ? -1 : 1);
+      int pos = side == 0 ? 0 : n - bs;  // where the coupling block acts
+      int col_off = side == 0 ? bs : 0;  // V_k multiplies u_{k-1}, W_k t_{k+1}
+      for (int col = 0; col < bs; col++) {
+        memset(r, 0, n*sizeof(double));
+        for (int row = 0; row < bs; row++)
+          r[pos + row] = c[row*bs + col];
+        this->solve_range(first, last, r);
+        for (int row = 0; row < bs; row++) {
+          dst[row*rs + col_off + col] = r[row];
+          dst[(bs + row)*rs + col_off + col] = r[n - bs + row];
+        }
+      }
+    }
+    delete [] r;
+  }
+  this->reduced->factorize();
+  this->factorized = true;
+}
+
+void BlockTridiagMatrix::solve(double *b)
+{
+  if (!this->factorized) this->factorize();
+  int bs = this->block_size;
+  if (this->n_parts == 1) {
+    this->solve_range(0, this->n_blocks-1, b);
+    return;
+  }
+
+  // local solves, collecting the interface values A_k^{-1} b_k
+  int rs = 2*bs;
+  double *z = new double[this->n_parts*rs];
+  #pragma omp parallel for schedule(static)
+  for (int k = 0; k < this->n_parts; k++) {
+    int first = this->part_first[k];
+    int last = this->part_first[k+1] - 1;
+    this->solve_range(first, last, b + first*bs);
+    memcpy(z + k*rs, b + first*bs, bs*sizeof(double));
+    memcpy(z + k*rs + bs, b + last*bs, bs*sizeof(double));
+  }
+
+  // interface unknowns (t_k, u_k)
+  this->reduced->solve(z);
+
+  // x_k = A_k^{-1} b_k - A_k^{-1} (L_{s_k} u_{k-1} + U_{e_k} t_{k+1})
+  BlockKernels kern = get_block_kernels(bs);
+  double *tmp = new double[this->size];
+  #pragma omp parallel for schedule(static)
+  for (int k = 0; k < this->n_parts; k++) {
+    int first = this->part_first[k];
+    int last = this->part_first[k+1] - 1;
+    int n = (last - first + 1)*bs;
+    double *r = tmp + first*bs;
+    memset(r, 0, n*sizeof(double));
+    if (k > 0)
+      kern.gemv_sub(r, this->get_block(first, -1), z + (k-1)*rs + bs, bs);
+    if (k < this->n_parts-1)
+      kern.gemv_sub(r + n - bs, this->get_block(last, 1), z + (k+1)*rs, bs);
+    this->solve_range(first, last, r);
+    for (int i = 0; i < n; i++)
+      b[first*bs + i] += r[i];
+  }
+  delete [] tmp;
+  delete [] z;
+}
+
+void solve_linear_system_block_tridiag(BlockTridiagMatrix *mat, double *res)
+{
+    mat->factorize();
+    mat->solve(res);
+}
+
+void solve_linear_system_block_tridiag_parallel(BlockTridiagMatrix *mat,
+        double *res, int n_parts)
+{
+    if (n_parts == 0) {
+#ifdef _OPENMP
+        n_parts = omp_get_max_threads();
+#else
+        n_parts = 1;
+#endif
+    }
+    mat->factorize(n_parts);
+    mat->solve(res);
 }
@@ -59,11 +59,13 @@ void chsgn(T** matrix, int m, int n)
 
 
 /// Given a matrix a[n][n], this routine replaces it by the LU decomposition of a rowwise
-/// permutation of itself. a and n are input. a is output, arranged as in equation (2.3.14) above;
-/// indx[n] is an output vector that records the row permutation effected by the partial
-/// pivoting; d is output as +-1 depending on whether the number of row interchanges was even
-/// or odd, respectively. This routine is used in combination with lubksb to solve linear equations
-/// or invert a matrix.
+/// permutation of itself, computed by a blocked (right-looking) algorithm with partial
+/// pivoting. a and n are input. a is output, with the unit lower triangular factor L below
+/// the diagonal and U on and above it; the row interchanges are done by swapping the row
+/// pointers a[i]. indx[n] is an output vector that records the row permutation effected by the
+/// partial pivoting; d is output as +-1 depending on whether the number of row interchanges
+/// was even or odd, respectively. This routine is used in combination with lubksb to solve linear
+/// equations or invert a matrix.
 void ludcmp(double** a, int n, int* indx, double* d);
 
 /// Solves the set of n linear equations AX = B. Here a[n][n] is input, not as the matrix
@@ -235,24 +237,32 @@ class DenseMatrix : public Matrix {
         DenseMatrix(int size) {
             this->mat = new_matrix<double>(size, size);
             this->size = size;
+            this->indx = NULL;
             this->zero();
         }
         DenseMatrix(Matrix *m) {
             this->mat = new_matrix<double>(m->get_size(), m->get_size());
+            this->indx = NULL;
             //printf("%d %d", this->size, m->get_size());
             //exit(1);
             this->size = m->get_size();
             //this->size = size;
             m->copy_into(this);
         }
+        virtual ~DenseMatrix() {
+            delete [] (char *) this->mat;
+            delete [] this->indx;
+        }
         virtual void zero() {
             // erase matrix
             for(int i = 0; i < this->size; i++)
                 for(int j = 0; j < this->size; j++)
                     this->mat[i][j] = 0;
+            this->factorized = false;
         }
         virtual void add(int m, int n, double v) {
             this->mat[m][n] += v;
+            this->factorized = false;
             //printf("calling add: %d %d %f\n", m, n, v);
         }
         virtual double get(int m, int n) {
@@ -293,9 +303,20 @@ class DenseMatrix : public Matrix {
             return this->mat;
         }
 
+        // LU decomposition (in place), the entries are replaced by the
+        // factors (see ludcmp()). zero() and add() mark the matrix as not
+        // factorized.
+        void factorize();
+        // Solve the system using the factorization, 'b' is overwritten
+        // by the solution. Calls factorize() if needed, so that several
+        // right-hand sides can be solved with one factorization.
+        void solve(double *b);
+
     private:
         int size;
         double **mat;
+        int *indx;         // row permutation of the LU decomposition
+        bool factorized;
 
 };
 
@@ -385,8 +406,145 @@ class CSRMatrix : public Matrix {
 
 };
 
+/// Block-tridiagonal matrix, as obtained for 1D systems when the unknowns
+/// are numbered element by element. Note that Mesh::assign_dofs() numbers
+/// all bubble dofs after the vertex dofs, so a global matrix assembled by
+/// DiscreteProblem only fits into this pattern for p = 1 (or for a system
+/// from which the bubbles have been eliminated by static condensation, see
+/// project_l2()); add() calls error() for entries outside of the pattern.
+/// The matrix consists of n_blocks x n_blocks
+/// square blocks of size block_size, only the blocks (i, i-1), (i, i) and
+/// (i, i+1) can be nonzero. The three blocks of each block row are stored
+/// contiguously (lower, diagonal, upper), each of them row-major, so the
+/// memory footprint is exactly 3*n_blocks*block_size^2 doubles.
+///
+/// factorize() overwrites the blocks by a blocked LU decomposition (blocked
+/// Thomas algorithm), after which solve() can be called repeatedly for
+/// different right-hand sides. Entries returned by get() are the factors
+/// after factorize() has been called. factorize() does nothing if the
+/// matrix is already factorized; zero() and add() mark it as not
+/// factorized (add() should only follow zero(), since it adds to the
+/// factors otherwise).
+///
+/// factorize(n_parts) with n_parts > 1 uses a partitioned (SPIKE-type)
+/// algorithm instead: the block rows are split into n_parts contiguous
+/// ranges which are factorized independently (in parallel when OpenMP is
+/// enabled), and the coupling between them is resolved through a small
+/// reduced block-tridiagonal system for the first and last unknowns of each
+/// range. The result equals the serial solve up to round-off.
+class BlockTridiagMatrix : public Matrix {
+    public:
+        BlockTridiagMatrix(int n_blocks, int block_size) {
+            this->n_blocks = n_blocks;
+            this->block_size = block_size;
+            this->size = n_blocks*block_size;
+            this->blocks = new double[3*n_blocks*block_size*block_size];
+            this->piv = new int[this->size];
+            this->n_parts = 1;
+            this->part_first = NULL;
+            this->reduced = NULL;
+            this->zero();
+        }
+        virtual ~BlockTridiagMatrix() {
+            delete [] this->blocks;
+            delete [] this->piv;
+            delete [] this->part_first;
+            delete this->reduced;
+        }
+        virtual void zero() {
+            memset(this->blocks, 0,
+                    3*this->n_blocks*this->block_size*this->block_size*sizeof(double));
+            this->factorized = false;
+        }
+        virtual void add(int m, int n, double v) {
+            double *a = this->get_entry(m, n);
+            if (a == NULL) error("Entry outside of the block-tridiagonal pattern.");
+            *a += v;
+            this->factorized = false;
+        }
+        virtual double get(int m, int n) {
+            double *a = this->get_entry(m, n);
+            return a == NULL ? 0 : *a;
+        }
+
+        virtual int get_size() {
+            return this->size;
+        }
+        virtual void copy_into(Matrix *m) {
+            m->zero();
+            for (int i = 0; i < this->size; i++) {
+                int bi = i / this->block_size;
+                int j_min = std::max(bi-1, 0) * this->block_size;
+                int j_max = std::min(bi+2, this->n_blocks) * this->block_size;
+                for (int j = j_min; j < j_max; j++) {
+                    double v = this->get(i, j);
+                    if (fabs(v) > 1e-12)
+                        m->add(i, j, v);
+                }
+            }
+        }
+
+        virtual void print() {
+            for (int i = 0; i < this->size; i++) {
+                for (int j = 0; j < this->size; j++)
+                    printf("%f ", this->get(i, j));
+                printf("\n");
+            }
+        }
+
+        int get_n_blocks() {
+            return this->n_blocks;
+        }
+        int get_block_size() {
+            return this->block_size;
+        }
+        // Return the block (i, i+offset), offset being -1, 0 or 1.
+        double *get_block(int i, int offset) {
+            return this->blocks +
+                (3*i + 1 + offset)*this->block_size*this->block_size;
+        }
+
+        // Blocked LU decomposition (in place), partitioned into 'n_parts'
+        // independent ranges of block rows. Does nothing if the matrix
+        // is already factorized.
+        void factorize(int n_parts=1);
+        // Solve the system using the factorization, 'b' is overwritten
+        // by the solution. Calls factorize() if needed.
+        void solve(double *b);
+
+    private:
+        int n_blocks;
+        int block_size;
+        int size;
+        double *blocks;
+        int *piv;          // row pivots of the diagonal blocks
+        bool factorized;
+        int n_parts;       // number of partitions used by factorize()
+        int *part_first;   // first block row of each partition
+        BlockTridiagMatrix *reduced; // interface system for n_parts > 1
+
+        // factorize the block rows first...last as a standalone system
+        void factorize_range(int first, int last);
+        // solve with the factors of the block rows first...last, 'b'
+        // holds the blocks first...last only
+        void solve_range(int first, int last, double *b);
+
+        double *get_entry(int m, int n) {
+            int bi = m / this->block_size;
+            int bj = n / this->block_size;
+            if (bj < bi-1 || bj > bi+1 || bj < 0 || bj >= this->n_blocks)
+                return NULL;
+            return this->get_block(bi, bj-bi) +
+                (m % this->block_size)*this->block_size + n % this->block_size;
+        }
+};
+
 // solve linear system
 void solve_linear_system(Matrix *mat, double *res);
 void solve_linear_system_dense(DenseMatrix *mat, double *res);
+void solve_linear_system_block_tridiag(BlockTridiagMatrix *mat, double *res);
+// n_parts == 0 means one partition per OpenMP thread
+void solve_linear_system_block_tridiag_parallel(BlockTridiagMatrix *mat,
+        double *res, int n_parts=0);
 
 #endif
@@ -1,12 +1,27 @@
+#include <algorithm>
+
 #include "mesh.h"
+#include "file_store.h"
 
 void Mesh::create(double A, double B, int n_elem)
+{
+  double *pts = new double[n_elem+1];
+  double h = (B - A)/n_elem;
+  for(int i = 0; i < n_elem+1; i++) {
+    pts[i] = A + i*h;                         // equidistant division
+  }
+  this->create(n_elem, pts);
+  delete [] pts;
+}
+
+void Mesh::create(int n_elem, double *pts)
 {
   this->n_elem = n_elem;
+  this->revision++;
   this->vertices = new Vertex[n_elem+1];    // allocate array of vertices
-  double h = (B - A)/n_elem;
   for(int i = 0; i < n_elem+1; i++) {
-    this->vertices[i].x = A + i*h;             // so far equidistant division only
+    if (i > 0 && pts[i] <= pts[i-1]) error("Mesh: vertices must increase.");
+    this->vertices[i].x = pts[i];
   }
   this->elems = new Element[n_elem];                // allocate array of elements
   for(int i=0; i<n_elem; i++) {
@@ -19,14 +34,33 @@ void Mesh::create(double A, double B, int n_elem)
 
 void Mesh::set_poly_orders(int poly_order)
 {
+  this->revision++;
   for(int i=0; i < this->n_elem; i++) {
     this->elems[i].p = poly_order;
     this->elems[i].dof = new int[poly_order+1];
   }
 }
 
+void Mesh::set_poly_orders(int *poly_orders)
+{
+  this->revision++;
+  for(int i=0; i < this->n_elem; i++) {
+    this->elems[i].p = poly_orders[i];
+    this->elems[i].dof = new int[poly_orders[i]+1];
+  }
+}
+
+int Mesh::get_max_poly_order()
+{
+  int p_max = 0;
+  for(int i=0; i < this->n_elem; i++)
+    if (this->elems[i].p > p_max) p_max = this->elems[i].p;
+  return p_max;
+}
+
 void Mesh::assign_dofs()
 {
+  this->revision++;
   // define element connectivities
   // (so far only for zero Dirichlet conditions)
   // (a) enumerate vertex dofs
@@ -79,8 +113,10 @@ void Mesh::assign_dofs()
 // point 'x_ref'. Here 'y' is the global vector of coefficients
 void Linearizer::eval_approx(Element *e, double x_ref, double *y, double &x_phys, double &val) {
   val = 0;
+  double shape_val[e->p + 1];
+  lobatto_eval(e->p, 1, &x_ref, shape_val, NULL);
   for(int i=0; i <= e->p; i++) {
-    if(e->dof[i] >= 0) val += y[e->dof[i]]*lobatto_fn_tab_1d[i](x_ref);
+    if(e->dof[i] >= 0) val += y[e->dof[i]]*shape_val[i];
   }
   double a = e->v1->x;
   double b = e->v2->x;
@@ -90,15 +126,14 @@ void Linearizer::eval_approx(Element *e, double x_ref, double *y, double &x_phys
 
 void calculate_elem_coeffs(Mesh *mesh, int m, double *y_prev, double *coeffs);
 
-void Linearizer::plot_solution(const char *out_filename, double *y_prev, int plotting_elem_subdivision)
+// write the solution in elements first...last to 'f' in Gnuplot format
+void Linearizer::plot_elements(FILE *f, double *y_prev, int first, int last,
+        int plotting_elem_subdivision)
 {
-  // Plot solution in Gnuplot format
   Element *elems = this->mesh->get_elems();
-  FILE *f = fopen(out_filename, "wb");
-  // FIXME: this is a memory leak!!!
   double *phys_u_prev =    new double[plotting_elem_subdivision + 1];
   double *phys_du_prevdx = new double[plotting_elem_subdivision + 1];
-  for(int m=0; m<this->mesh->get_n_elems(); m++) {
+  for(int m=first; m<=last; m++) {
     double coeffs[100];
     calculate_elem_coeffs(this->mesh, m, y_prev, coeffs); 
 
@@ -125,6 +160,36 @@ void Linearizer::plot_solution(const char *out_filename, double *y_prev, int plo
     for (int j=0; j<plotting_elem_subdivision+1; j++)
       fprintf(f, "%g %g\n", (a + b)/2 + pts_array[j] * (b-a)/2, phys_u_prev[j]);
   }
+  delete [] phys_u_prev;
+  delete [] phys_du_prevdx;
+}
+
+void Linearizer::plot_solution(const char *out_filename, double *y_prev, int plotting_elem_subdivision)
+{
+  // Plot solution in Gnuplot format
+  FILE *f = fopen(out_filename, "wb");
+  this->plot_elements(f, y_prev, 0, this->mesh->get_n_elems()-1,
+                      plotting_elem_subdivision);
+  fclose(f);
+}
+
+// number of elements plotted between read-ahead hints
+#define PLOT_CHUNK 4096
+
+void Linearizer::plot_solution(const char *out_filename, MappedVector *y_prev,
+        int plotting_elem_subdivision)
+{
+  FILE *f = fopen(out_filename, "wb");
+  int n_elem = this->mesh->get_n_elems();
+  y_prev->prefetch_elems(this->mesh, 0, PLOT_CHUNK-1);
+  for(int first=0; first<n_elem; first+=PLOT_CHUNK) {
+    int last = std::min(first + PLOT_CHUNK, n_elem) - 1;
+    // read ahead the next chunk while this one is being written
+    y_prev->prefetch_elems(this->mesh, last+1, last+PLOT_CHUNK);
+    this->plot_elements(f, y_prev->get_data(), first, last,
+                        plotting_elem_subdivision);
+    y_prev->release_elems(this->mesh, first, last);
+  }
   fclose(f);
 }
 
@@ -9,10 +9,14 @@ class Mesh {
     public:
         Mesh(int n_eqn) {
             // Print the banner (only once)
+            // (meshes may be created by several threads at once)
             static int n_calls = 0;
-            n_calls++;
-            if (n_calls == 1) intro();
+            int calls;
+            #pragma omp atomic capture
+            calls = ++n_calls;
+            if (calls == 1) intro();
             this->n_eqn = n_eqn;
+            this->revision = 0;
             this->bc_left_dir = new int[n_eqn];
             this->bc_left_dir_values = new double[n_eqn];
             this->bc_right_dir = new int[n_eqn];
@@ -25,7 +29,11 @@ class Mesh {
             }
         }
         void create(double A, double B, int n);
+        /// Creates the n elements with the vertices pts[0] < ... < pts[n].
+        void create(int n, double *pts);
         void set_poly_orders(int poly_order);
+        /// Sets the degree of the m-th element to poly_orders[m].
+        void set_poly_orders(int *poly_orders);
         void assign_dofs();
         Vertex *get_vertices() {
             return this->vertices;
@@ -39,6 +47,16 @@ class Mesh {
         int get_n_dof() {
             return this->n_dof;
         }
+        int get_n_eqn() {
+            return this->n_eqn;
+        }
+        int get_max_poly_order();
+        /// The revision is incremented by every change of the elements,
+        /// their degrees or the dof numbering, so that data derived from
+        /// the mesh can be cached and recomputed when it changes.
+        int get_revision() {
+            return this->revision;
+        }
         void set_bc_left_dirichlet(int eq_n, double val);
         void set_bc_left_natural(int eqn);
         void set_bc_right_dirichlet(int eq_n, double val);
@@ -59,11 +77,14 @@ class Mesh {
         int n_eqn;
         int n_elem;
         int n_dof;
+        int revision;
         Vertex *vertices;
         Element *elems;
 
 };
 
+class MappedVector;
+
 class Linearizer {
     public:
         Linearizer(Mesh *mesh) {
@@ -75,9 +96,15 @@ class Linearizer {
                 double &val);
         void plot_solution(const char *out_filename, double *y_prev, int
                 plotting_elem_subdivision=100);
+        // same for a solution stored out of core, which is read in chunks
+        void plot_solution(const char *out_filename, MappedVector *y_prev,
+                int plotting_elem_subdivision=100);
 
     private:
         Mesh *mesh;
+
+        void plot_elements(FILE *f, double *y_prev, int first, int last,
+                int plotting_elem_subdivision);
 };
 
 void element_solution(Element *e, double *coeff, int pts_num, 
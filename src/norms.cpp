@@ -0,0 +1,215 @@
+#include <algorithm>
+
+#include "norms.h"
+
+// the errors against exact solutions are integrated with Gauss rules of
+// order 2p + NORM_ORDER_INC
+#define NORM_ORDER_INC 10
+
+void calculate_elem_coeffs(Mesh *mesh, int m, double *y_prev, double *coeffs);
+
+ErrorNorm::ErrorNorm(int type, energy_weights weights, void *user_data)
+{
+  if (type < NORM_L2 || type > NORM_ENERGY) error("ErrorNorm: unknown norm.");
+  if (type == NORM_ENERGY && weights == NULL)
+    error("ErrorNorm: the energy norm needs weights.");
+  this->type = type;
+  this->weights = weights;
+  this->user_data = user_data;
+}
+
+double ErrorNorm::integrate(int num, double *x, double *w, double *e,
+        double *dedx)
+{
+  double val = 0;
+  switch (this->type) {
+    case NORM_L2:
+      for (int i=0; i<num; i++) val += w[i]*e[i]*e[i];
+      break;
+    case NORM_H1:
+      for (int i=0; i<num; i++) val += w[i]*(e[i]*e[i] + dedx[i]*dedx[i]);
+      break;
+    case NORM_H1_SEMI:
+      for (int i=0; i<num; i++) val += w[i]*dedx[i]*dedx[i];
+      break;
+    case NORM_ENERGY: {
+      double a[num], c[num];
+      this->weights(num, x, a, c, this->user_data);
+      for (int i=0; i<num; i++)
+        val += w[i]*(a[i]*dedx[i]*dedx[i] + c[i]*e[i]*e[i]);
+      break;
+    }
+  }
+  return val;
+}
+
+double ErrorNorm::calc(Mesh *mesh, double *y, projection_fn exact,
+        void *exact_data, double *elem_errors)
+{
+  if (mesh->get_n_eqn() > 1) error("ErrorNorm: more than one equation.");
+  Element *elems = mesh->get_elems();
+  int n_elem = mesh->get_n_elems();
+  int max_order = g_quad_1d_std.get_max_order();
+  double total = 0;
+  #pragma omp parallel for schedule(static) reduction(+:total)
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    double a = e->v1->x, b = e->v2->x;
+    int order = exact == NULL ? 2*e->p : 2*e->p + NORM_ORDER_INC;
+    if (this->type == NORM_ENERGY) order += NORM_ORDER_INC;
+    order = std::min(order, max_order);
+    int n_pts = g_quad_1d_std.get_num_points(order);
+    double2 *quad = g_quad_1d_std.get_points(order);
+    double pts[n_pts], x[n_pts], w[n_pts], val[n_pts], der[n_pts];
+    for (int i=0; i<n_pts; i++) {
+      pts[i] = quad[i][0];
+      x[i] = (a+b)/2 + pts[i]*(b-a)/2;
+      w[i] = quad[i][1]*(b-a)/2;
+    }
+    double coeffs[e->p+1];
+    calculate_elem_coeffs(mesh, m, y, coeffs);
+    element_solution(e, coeffs, n_pts, pts, val, der);
+    if (exact != NULL) {
+      bool need_der = this->type != NORM_L2;
+      for (int i=0; i<n_pts; i++) {
+        double dfdx = 0;
+        val[i] -= exact(x[i], need_der ? &dfdx : NULL, exact_data);
+        der[i] -= dfdx;
+      }
+    }
+    double err = this->integrate(n_pts, x, w, val, der);
+    if (elem_errors != NULL) elem_errors[m] = sqrt(err);
+    total += err;
+  }
+  return sqrt(total);
+}
+
+double ErrorNorm::calc_error(Mesh *mesh, double *y, projection_fn exact,
+        void *exact_data, double *elem_errors)
+{
+  return this->calc(mesh, y, exact, exact_data, elem_errors);
+}
+
+double ErrorNorm::calc_norm(Mesh *mesh, double *y, double *elem_norms)
+{
+  return this->calc(mesh, y, NULL, NULL, elem_norms);
+}
+
+double ErrorNorm::calc_error(Mesh *mesh, double *y, Mesh *ref_mesh,
+        double *y_ref, double *elem_errors)
+{
+  if (mesh->get_n_eqn() > 1 || ref_mesh->get_n_eqn() > 1)
+    error("ErrorNorm: more than one equation.");
+  Element *elems = mesh->get_elems();
+  Element *r_elems = ref_mesh->get_elems();
+  int n_elem = mesh->get_n_elems();
+  int n_ref = ref_mesh->get_n_elems();
+  double L = elems[n_elem-1].v2->x - elems[0].v1->x;
+  if (fabs(elems[0].v1->x - r_elems[0].v1->x) > 1e-12*L ||
+      fabs(elems[n_elem-1].v2->x - r_elems[n_ref-1].v2->x) > 1e-12*L)
+    error("ErrorNorm: the meshes cover different intervals.");
+
+  // first reference element overlapping every element
+  int *first = new int[n_elem];
+  for (int m=0, r=0; m<n_elem; m++) {
+    while (r < n_ref-1 && r_elems[r].v2->x <= elems[m].v1->x) r++;
+    first[m] = r;
+  }
+
+  int max_order = g_quad_1d_std.get_max_order();
+  double total = 0;
+  #pragma omp parallel for schedule(static) reduction(+:total)
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    double a = e->v1->x, b = e->v2->x;
+    double coeffs[e->p+1];
+    calculate_elem_coeffs(mesh, m, y, coeffs);
+    double err = 0;
+    // the parts of the element cut by the reference vertices, on which
+    // both solutions are polynomials
+    for (int r=first[m]; r<n_ref; r++) {
+      Element *re = r_elems + r;
+      double A = re->v1->x, B = re->v2->x;
+      double s = std::max(a, A), t = std::min(b, B);
+      if (t > s) {
+        int order = 2*std::max(e->p, re->p);
+        if (this->type == NORM_ENERGY) order += NORM_ORDER_INC;
+        order = std::min(order, max_order);
+        int n_pts = g_quad_1d_std.get_num_points(order);
+        double2 *quad = g_quad_1d_std.get_points(order);
+        double x[n_pts], w[n_pts], xi[n_pts], eta[n_pts];
+        double val[n_pts], der[n_pts], r_val[n_pts], r_der[n_pts];
+        for (int i=0; i<n_pts; i++) {
+          x[i] = (s+t)/2 + quad[i][0]*(t-s)/2;
+          w[i] = quad[i][1]*(t-s)/2;
+          xi[i] = std::max(-1., std::min(1., (2*x[i] - a - b)/(b - a)));
+          eta[i] = std::max(-1., std::min(1., (2*x[i] - A - B)/(B - A)));
+        }
+        double r_coeffs[re->p+1];
+        calculate_elem_coeffs(ref_mesh, r, y_ref, r_coeffs);
+        element_solution(e, coeffs, n_pts, xi, val, der);
+        element_solution(re, r_coeffs, n_pts, eta, r_val, r_der);
+        for (int i=0; i<n_pts; i++) {
+          val[i] -= r_val[i];
+          der[i] -= r_der[i];
+        }
+        err += this->integrate(n_pts, x, w, val, der);
+      }
+      if (B >= b) break;
+    }
+    if (elem_errors != NULL) elem_errors[m] = sqrt(err);
+    total += err;
+  }
+  delete [] first;
+  return sqrt(total);
+}
+
+void calc_bubble_indicators(Mesh *mesh, double *y, double *indicators)
+{
+  if (mesh->get_n_eqn() > 1)
+    error("calc_bubble_indicators: more than one equation.");
+  Element *elems = mesh->get_elems();
+  int n_elem = mesh->get_n_elems();
+  // the derivatives of the bubbles are orthonormal on the reference
+  // element, so |c l_p|^2 in the H1 seminorm is c^2 * 2/h
+  #pragma omp parallel for schedule(static)
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    double h = e->v2->x - e->v1->x;
+    indicators[m] = e->p < 2 ? 0 : fabs(y[e->dof[e->p]])*sqrt(2/h);
+  }
+}
+
+void calc_residual_indicators(Mesh *mesh, double *y, ensemble_setup setup,
+        void *params, double *indicators, int p_increase)
+{
+  if (p_increase < 1) error("calc_residual_indicators: p_increase < 1.");
+  if (mesh->get_n_eqn() > 1)
+    error("calc_residual_indicators: more than one equation.");
+  Mesh *enr = create_refined_mesh(mesh, false, p_increase);
+  int n_dof = enr->get_n_dof();
+  double *y_enr = new double[n_dof];
+  double *res = new double[n_dof];
+  transfer_solution(mesh, y, enr, y_enr);
+  DiscreteProblem dp(enr->get_n_eqn(), enr);
+  setup(&dp, params);
+  dp.assemble_vector(res, y_enr);
+
+  // the added bubbles belong to one element each, so their residuals are
+  // local; dividing by the H1 seminorm of the bubbles (sqrt(2/h)) gives
+  // the dual norm
+  Element *elems = enr->get_elems();
+  int n_elem = enr->get_n_elems();
+  #pragma omp parallel for schedule(static)
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    double h = e->v2->x - e->v1->x;
+    double sum = 0;
+    for (int k=e->p - p_increase + 1; k<=e->p; k++)
+      sum += res[e->dof[k]]*res[e->dof[k]];
+    indicators[m] = sqrt(h/2*sum);
+  }
+  delete [] y_enr;
+  delete [] res;
+  delete enr;
+}
@@ -0,0 +1,82 @@
+#ifndef _NORMS_H_
+#define _NORMS_H_
+
+#include "ensemble.h"
+#include "projection.h"
+
+// Norms (see ErrorNorm)
+#define NORM_L2 0       // int e^2
+#define NORM_H1 1       // int e^2 + e'^2
+#define NORM_H1_SEMI 2  // int e'^2
+#define NORM_ENERGY 3   // int a(x) e'^2 + c(x) e^2
+
+/// Weights of the energy norm: stores a(x[i]) in a[i] and c(x[i]) in c[i]
+/// for i = 0, ..., num-1.
+typedef void (*energy_weights)(int num, double *x, double *a, double *c,
+                               void *user_data);
+
+/// \brief Norms of solutions and of their errors.
+///
+/// The norms are integrated element by element in a parallel loop (with
+/// OpenMP), with Gauss rules which are exact for the discrete solutions.
+/// If 'elem_errors' is not NULL, the norm of every element is stored in it
+/// (one entry per element of 'mesh'), so that it can serve as the error
+/// indicator of an adaptive loop. Only meshes with a single equation are
+/// supported, as for the indicators below (error() otherwise).
+class ErrorNorm {
+public:
+    /// 'type' is one of NORM_L2, NORM_H1, NORM_H1_SEMI and NORM_ENERGY;
+    /// the energy norm needs the weights 'weights', which receive
+    /// 'user_data'.
+    ErrorNorm(int type, energy_weights weights=NULL, void *user_data=NULL);
+
+    /// Norm of the difference of the solution 'y' on 'mesh' and the exact
+    /// solution 'exact' (which has to provide the derivative unless the
+    /// norm is NORM_L2).
+    double calc_error(Mesh *mesh, double *y, projection_fn exact,
+                      void *exact_data=NULL, double *elem_errors=NULL);
+    /// Norm of the difference of the solution 'y' on 'mesh' and the
+    /// reference solution 'y_ref' on 'ref_mesh', which covers the same
+    /// interval (usually a refinement of 'mesh'). The integrals are split
+    /// at the vertices of both meshes, so they are exact.
+    double calc_error(Mesh *mesh, double *y, Mesh *ref_mesh, double *y_ref,
+                      double *elem_errors=NULL);
+    /// Norm of the solution 'y' on 'mesh'.
+    double calc_norm(Mesh *mesh, double *y, double *elem_norms=NULL);
+
+private:
+    int type;
+    energy_weights weights;
+    void *user_data;
+
+    // sum_i w[i] * (density of the norm of e at x[i])
+    double integrate(int num, double *x, double *w, double *e, double *dedx);
+    double calc(Mesh *mesh, double *y, projection_fn exact, void *exact_data,
+                double *elem_errors);
+};
+
+/// Size of the highest bubble of every element: its norm in the H1
+/// seminorm, |c_p| sqrt(2/h) for the bubble coefficient c_p of an element
+/// of degree p >= 2 and length h. Elements of degree 1 get zero. This is
+/// not an error estimate: it measures the last hierarchic contribution,
+/// not what is missing, and at low degrees it can be far larger than the
+/// error and rank the elements differently. For smooth solutions and
+/// higher degrees, where the coefficients decay quickly, it can serve as a
+/// cheap indicator for choosing between h- and p-refinement. Use
+/// calc_residual_indicators() or a reference solution (see ErrorNorm) to
+/// estimate the error. Costs O(1) per element.
+void calc_bubble_indicators(Mesh *mesh, double *y, double *indicators);
+
+/// Residual-based error indicators: the solution 'y' is transferred to the
+/// mesh with all degrees raised by 'p_increase', the residual of the
+/// problem set up there by 'setup' with 'params' is assembled, and the
+/// indicator of every element is the dual norm of the residual on the
+/// added bubbles,
+///   sqrt(h/2 * sum_k r_k^2),   k = p+1, ..., p+p_increase,
+/// which for a Laplace-type operator is the energy norm of the local
+/// correction in the enriched space. Costs one residual assembly.
+void calc_residual_indicators(Mesh *mesh, double *y, ensemble_setup setup,
+                              void *params, double *indicators,
+                              int p_increase=1);
+
+#endif
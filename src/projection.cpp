@@ -0,0 +1,317 @@
+#include <algorithm>
+
+#include "projection.h"
+#include "matrix.h"
+#include "quad_std.h"
+
+// the function projections integrate with Gauss rules of order
+// 2p + PROJ_ORDER_INC
+#define PROJ_ORDER_INC 10
+
+void calculate_elem_coeffs(Mesh *mesh, int m, double *y_prev, double *coeffs);
+
+// Sets the bubble dofs of 'e' in 'y' to the H1_0 projection of a function
+// whose derivative du/dxi on the reference element is given at the n_pts
+// points of the Gauss rule 'quad'. As the derivatives of the bubbles are
+// orthonormal on (-1,1) and orthogonal to constants, the coefficient of l_k
+// is the integral of du/dxi * l_k', whatever the vertex values are (the
+// same holds in transfer_solution()).
+static void set_bubbles(Element *e, int n_pts, double2 *quad, double *dudxi,
+        double *y)
+{
+  double pts[n_pts];
+  for (int i=0; i<n_pts; i++) pts[i] = quad[i][0];
+  double shape_val[(e->p+1)*n_pts], shape_der[(e->p+1)*n_pts];
+  lobatto_eval(e->p, n_pts, pts, shape_val, shape_der);
+  for (int k=2; k<=e->p; k++) {
+    double c_k = 0;
+    for (int i=0; i<n_pts; i++)
+      c_k += quad[i][1] * dudxi[i] * shape_der[k*n_pts + i];
+    y[e->dof[k]] = c_k;
+  }
+}
+
+// Cholesky decomposition of the symmetric positive definite n x n matrix
+// 'a' (in place, lower triangle)
+static void cholesky(int n, double *a)
+{
+  for (int j=0; j<n; j++) {
+    double d = a[j*n + j];
+    for (int k=0; k<j; k++) d -= a[j*n + k]*a[j*n + k];
+    if (d <= 0) error("Matrix not positive definite.");
+    d = sqrt(d);
+    a[j*n + j] = d;
+    for (int i=j+1; i<n; i++) {
+      double v = a[i*n + j];
+      for (int k=0; k<j; k++) v -= a[i*n + k]*a[j*n + k];
+      a[i*n + j] = v / d;
+    }
+  }
+}
+
+// solves the system with the factor computed by cholesky(), 'b' is
+// overwritten by the solution
+static void cholesky_solve(int n, double *a, double *b)
+{
+  for (int i=0; i<n; i++) {
+    for (int k=0; k<i; k++) b[i] -= a[i*n + k]*b[k];
+    b[i] /= a[i*n + i];
+  }
+  for (int i=n-1; i>=0; i--) {
+    for (int k=i+1; k<n; k++) b[i] -= a[k*n + i]*b[k];
+    b[i] /= a[i*n + i];
+  }
+}
+
+Mesh *create_refined_mesh(Mesh *mesh, bool bisect, int p_increase)
+{
+  int n_eqn = mesh->get_n_eqn();
+  int n_elem = mesh->get_n_elems();
+  Element *elems = mesh->get_elems();
+  int n_fine = bisect ? 2*n_elem : n_elem;
+  double *pts = new double[n_fine+1];
+  int *orders = new int[n_fine];
+  for (int m=0; m<n_elem; m++) {
+    int p = elems[m].p + p_increase;
+    if (bisect) {
+      pts[2*m] = elems[m].v1->x;
+      pts[2*m+1] = (elems[m].v1->x + elems[m].v2->x)/2;
+      orders[2*m] = orders[2*m+1] = p;
+    }
+    else {
+      pts[m] = elems[m].v1->x;
+      orders[m] = p;
+    }
+  }
+  pts[n_fine] = elems[n_elem-1].v2->x;
+
+  Mesh *fine = new Mesh(n_eqn);
+  fine->create(n_fine, pts);
+  fine->set_poly_orders(orders);
+  for (int i=0; i<n_eqn; i++) {
+    if (mesh->bc_left_dir[i] == BC_DIRICHLET)
+      fine->set_bc_left_dirichlet(i, mesh->bc_left_dir_values[i]);
+    else if (mesh->bc_left_dir[i] == BC_NATURAL)
+      fine->set_bc_left_natural(i);
+    if (mesh->bc_right_dir[i] == BC_DIRICHLET)
+      fine->set_bc_right_dirichlet(i, mesh->bc_right_dir_values[i]);
+    else if (mesh->bc_right_dir[i] == BC_NATURAL)
+      fine->set_bc_right_natural(i);
+  }
+  fine->assign_dofs();
+  delete [] pts;
+  delete [] orders;
+  return fine;
+}
+
+// value of the solution 'y' on 'mesh' at the point x of its element m
+static double eval_solution(Mesh *mesh, int m, double *y, double x)
+{
+  Element *e = mesh->get_elems() + m;
+  double coeffs[e->p+1], val, der;
+  calculate_elem_coeffs(mesh, m, y, coeffs);
+  double a = e->v1->x, b = e->v2->x;
+  double x_ref = std::max(-1., std::min(1., (2*x - a - b)/(b - a)));
+  element_solution_point(x_ref, e, coeffs, &val, &der);
+  return val;
+}
+
+void transfer_solution(Mesh *from, double *y_from, Mesh *to, double *y_to)
+{
+  if (from->get_n_eqn() > 1 || to->get_n_eqn() > 1)
+    error("transfer_solution: more than one equation.");
+  Element *o_elems = from->get_elems();
+  Element *elems = to->get_elems();
+  int n_old = from->get_n_elems();
+  int n_elem = to->get_n_elems();
+  double L = o_elems[n_old-1].v2->x - o_elems[0].v1->x;
+  if (fabs(elems[0].v1->x - o_elems[0].v1->x) > 1e-12*L ||
+      fabs(elems[n_elem-1].v2->x - o_elems[n_old-1].v2->x) > 1e-12*L)
+    error("transfer_solution: the meshes cover different intervals.");
+
+  int first = 0;    // first old element overlapping the new one
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    double a = e->v1->x, b = e->v2->x;
+    while (first < n_old-1 && o_elems[first].v2->x <= a) first++;
+    if (e->dof[0] >= 0) y_to[e->dof[0]] = eval_solution(from, first, y_from, a);
+
+    // the bubbles, integrated over the parts of the element cut by the old
+    // vertices, on which the old solution is a polynomial
+    int last = first;   // old element containing b
+    double c[e->p+1];
+    for (int k=2; k<=e->p; k++) c[k] = 0;
+    for (int mo=first; mo<n_old; mo++) {
+      Element *o = o_elems + mo;
+      double A = o->v1->x, B = o->v2->x;
+      double s = std::max(a, A), t = std::min(b, B);
+      last = mo;
+      if (e->p >= 2 && t > s) {
+        int order = std::min(o->p + e->p, g_quad_1d_std.get_max_order());
+        int n_pts = g_quad_1d_std.get_num_points(order);
+        double2 *quad = g_quad_1d_std.get_points(order);
+        double xi[n_pts], eta[n_pts], val[n_pts], der[n_pts];
+        for (int i=0; i<n_pts; i++) {
+          double x = (s+t)/2 + quad[i][0]*(t-s)/2;
+          xi[i] = std::max(-1., std::min(1., (2*x - a - b)/(b - a)));
+          eta[i] = std::max(-1., std::min(1., (2*x - A - B)/(B - A)));
+        }
+        double coeffs[o->p+1];
+        calculate_elem_coeffs(from, mo, y_from, coeffs);
+        element_solution(o, coeffs, n_pts, eta, val, der);
+        double shape_val[(e->p+1)*n_pts], shape_der[(e->p+1)*n_pts];
+        lobatto_eval(e->p, n_pts, xi, shape_val, shape_der);
+        // integral of du/dxi * l_k' over the reference element, in the
+        // physical coordinate
+        for (int k=2; k<=e->p; k++)
+          for (int i=0; i<n_pts; i++)
+            c[k] += quad[i][1]*(t-s)/2 * der[i] * shape_der[k*n_pts + i];
+      }
+      if (B >= b) break;
+    }
+    for (int k=2; k<=e->p; k++) y_to[e->dof[k]] = c[k];
+    if (e->dof[1] >= 0) y_to[e->dof[1]] = eval_solution(from, last, y_from, b);
+  }
+}
+
+// Gauss rule of order 2p + PROJ_ORDER_INC, or of the highest order
+// available; returns the number of points
+static int projection_rule(int p, double2 **quad)
+{
+  int order = std::min(2*p + PROJ_ORDER_INC, g_quad_1d_std.get_max_order());
+  *quad = g_quad_1d_std.get_points(order);
+  return g_quad_1d_std.get_num_points(order);
+}
+
+void project_h1(Mesh *mesh, projection_fn fn, double *y, void *user_data)
+{
+  if (mesh->get_n_eqn() > 1) error("project_h1: more than one equation.");
+  Element *elems = mesh->get_elems();
+  int n_elem = mesh->get_n_elems();
+  // every element sets its left vertex dof (and the last one also the right
+  // one), so the elements are independent
+  #pragma omp parallel for schedule(static)
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    double a = e->v1->x, b = e->v2->x;
+    if (e->dof[0] >= 0) y[e->dof[0]] = fn(a, NULL, user_data);
+    if (m == n_elem-1 && e->dof[1] >= 0) y[e->dof[1]] = fn(b, NULL, user_data);
+    if (e->p < 2) continue;
+
+    double2 *quad;
+    int n_pts = projection_rule(e->p, &quad);
+    double dudxi[n_pts];
+    for (int i=0; i<n_pts; i++) {
+      double dfdx;
+      fn((a+b)/2 + quad[i][0]*(b-a)/2, &dfdx, user_data);
+      dudxi[i] = dfdx*(b-a)/2;
+    }
+    set_bubbles(e, n_pts, quad, dudxi, y);
+  }
+}
+
+void project_l2(Mesh *mesh, projection_fn fn, double *y, void *user_data)
+{
+  if (mesh->get_n_eqn() > 1) error("project_l2: more than one equation.");
+  Element *elems = mesh->get_elems();
+  int n_elem = mesh->get_n_elems();
+  // the vertex dofs are numbered first, from left to right, so the vertex
+  // system is tridiagonal
+  int n_vert = 0;
+  for (int m=0; m<n_elem; m++)
+    for (int v=0; v<2; v++) n_vert = std::max(n_vert, elems[m].dof[v]+1);
+  double bc_val[2] = {mesh->bc_left_dir_values[0],
+                      mesh->bc_right_dir_values[0]};
+
+  // For every element, M_BB^{-1} r_B and M_BB^{-1} M_BV are kept, M being
+  // the local mass matrix, r the local right-hand side, B the bubbles and
+  // V the vertices: once the vertex values u_V are known, the bubbles are
+  // u_B = M_BB^{-1} r_B - M_BB^{-1} M_BV u_V.
+  int *offset = new int[n_elem+1];
+  offset[0] = 0;
+  for (int m=0; m<n_elem; m++)
+    offset[m+1] = offset[m] + 3*std::max(elems[m].p - 1, 0);
+  double *cond = new double[offset[n_elem]];
+  BlockTridiagMatrix mat(std::max(n_vert, 1), 1);
+  double *rhs = new double[std::max(n_vert, 1)];
+  for (int i=0; i<n_vert; i++) rhs[i] = 0;
+
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    int n = e->p + 1, nb = e->p - 1;
+    double a = e->v1->x, b = e->v2->x;
+    double2 *quad;
+    int n_pts = projection_rule(e->p, &quad);
+    double pts[n_pts], f[n_pts], shape[n*n_pts];
+    for (int i=0; i<n_pts; i++) {
+      pts[i] = quad[i][0];
+      f[i] = fn((a+b)/2 + pts[i]*(b-a)/2, NULL, user_data) * quad[i][1]*(b-a)/2;
+    }
+    lobatto_eval(e->p, n_pts, pts, shape, NULL);
+
+    // local mass matrix and right-hand side
+    double mass[n*n], r[n];
+    for (int i=0; i<n; i++) {
+      r[i] = 0;
+      for (int k=0; k<n_pts; k++) r[i] += f[k]*shape[i*n_pts + k];
+      for (int j=0; j<=i; j++) {
+        double v = 0;
+        for (int k=0; k<n_pts; k++)
+          v += quad[k][1]*shape[i*n_pts + k]*shape[j*n_pts + k];
+        mass[i*n + j] = mass[j*n + i] = v*(b-a)/2;
+      }
+    }
+
+    // eliminate the bubbles: S = M_VV - M_VB Z, r_V -= M_VB z
+    double *z = cond + offset[m], *Z = z + nb;   // Z[k*2 + v]
+    double s[2][2] = {{mass[0], mass[1]}, {mass[n], mass[n+1]}};
+    if (nb > 0) {
+      double mbb[nb*nb], col[nb];
+      for (int k=0; k<nb; k++)
+        for (int l=0; l<nb; l++) mbb[k*nb + l] = mass[(k+2)*n + l+2];
+      cholesky(nb, mbb);
+      for (int k=0; k<nb; k++) z[k] = r[k+2];
+      cholesky_solve(nb, mbb, z);
+      for (int v=0; v<2; v++) {
+        for (int k=0; k<nb; k++) col[k] = mass[(k+2)*n + v];
+        cholesky_solve(nb, mbb, col);
+        for (int k=0; k<nb; k++) Z[k*2 + v] = col[k];
+      }
+      for (int v=0; v<2; v++) {
+        for (int k=0; k<nb; k++) {
+          r[v] -= mass[v*n + k+2]*z[k];
+          for (int w=0; w<2; w++) s[v][w] -= mass[v*n + k+2]*Z[k*2 + w];
+        }
+      }
+    }
+
+    // assemble the vertex system, the Dirichlet values go to the
+    // right-hand side
+    for (int v=0; v<2; v++) {
+      if (e->dof[v] < 0) continue;
+      rhs[e->dof[v]] += r[v];
+      for (int w=0; w<2; w++) {
+        if (e->dof[w] >= 0) mat.add(e->dof[v], e->dof[w], s[v][w]);
+        else rhs[e->dof[v]] -= s[v][w]*bc_val[w];
+      }
+    }
+  }
+  if (n_vert > 0) solve_linear_system_block_tridiag(&mat, rhs);
+
+  // vertex values and bubbles
+  for (int m=0; m<n_elem; m++) {
+    Element *e = elems + m;
+    int nb = e->p - 1;
+    double u_v[2];
+    for (int v=0; v<2; v++) {
+      u_v[v] = e->dof[v] >= 0 ? rhs[e->dof[v]] : bc_val[v];
+      if (e->dof[v] >= 0) y[e->dof[v]] = u_v[v];
+    }
+    double *z = cond + offset[m], *Z = z + nb;
+    for (int k=0; k<nb; k++)
+      y[e->dof[k+2]] = z[k] - Z[k*2]*u_v[0] - Z[k*2 + 1]*u_v[1];
+  }
+  delete [] offset;
+  delete [] cond;
+  delete [] rhs;
+}
@@ -0,0 +1,49 @@
+#ifndef _PROJECTION_H_
+#define _PROJECTION_H_
+
+#include "mesh.h"
+
+/// A function to be projected: returns f(x) and stores f'(x) in *dfdx
+/// unless dfdx is NULL. 'user_data' is the pointer passed to the projection.
+typedef double (*projection_fn)(double x, double *dfdx, void *user_data);
+
+/// Returns a new mesh refined from 'mesh': every element is bisected if
+/// 'bisect' is true, and the degree of every element is raised by
+/// 'p_increase'. The boundary conditions are copied and the dofs assigned.
+/// The caller owns the new mesh.
+Mesh *create_refined_mesh(Mesh *mesh, bool bisect, int p_increase);
+
+/// Transfers the solution 'y_from' on the mesh 'from' to the solution
+/// 'y_to' on the mesh 'to', which covers the same interval but may be
+/// refined, coarsened or have other degrees. The vertex dofs are the values
+/// of the old solution at the new vertices, and the bubble dofs of every new
+/// element are the H1_0 projection of the rest, integrated exactly over the
+/// parts of the element cut by the old vertices. The transfer is therefore
+/// exact when the new space contains the old one (e.g. after bisection or
+/// raising the degrees) and a local projection otherwise. Both meshes are
+/// walked once, so the cost is O(number of elements), with no global solve.
+/// The Dirichlet dofs are given by the boundary conditions of 'to'. Meshes
+/// with more than one equation are not supported (error()).
+void transfer_solution(Mesh *from, double *y_from, Mesh *to, double *y_to);
+
+/// Projection of 'fn' onto the finite element space of 'mesh' (projection
+/// based interpolation): the vertex dofs are the values of fn at the
+/// vertices, and the bubble dofs of every element are the projection of the
+/// rest in the H1_0 seminorm. The derivatives of the Lobatto bubbles are
+/// orthonormal in this seminorm, so every bubble coefficient is a single
+/// integral and there is no system to solve. The result is exact for
+/// functions in the space and quasi-optimal in the H1 norm. The Dirichlet
+/// dofs are given by the boundary conditions and are not set. The elements
+/// are processed in parallel, so fn may be called from several threads.
+/// Like project_l2(), it only supports meshes with a single equation and
+/// calls error() otherwise.
+void project_h1(Mesh *mesh, projection_fn fn, double *y, void *user_data=NULL);
+
+/// L2 projection of 'fn' (its derivative is not needed) onto the finite
+/// element space of 'mesh', the Dirichlet values being those of the
+/// boundary conditions. The bubbles are eliminated element by element, which
+/// leaves a tridiagonal system for the vertex dofs, so the cost is linear
+/// in the number of elements.
+void project_l2(Mesh *mesh, projection_fn fn, double *y, void *user_data=NULL);
+
+#endif
@@ -0,0 +1,1651 @@
+#include "quad_std.h"
+
+//// 1D quadrature tables //////////////////////////////
+
+
+static double2 std_pts_0_1_1d[] = 
+{
+  { 0.0, 2.0 }
+};
+
+static double2 std_pts_2_3_1d[] = 
+{
+  { -0.57735026918963,  1.0 }, //  { -1.0/sqrt(3.0), 1.0 },
+  {  0.57735026918963,  1.0 }  //  {  1.0/sqrt(3.0), 1.0 },
+};
+
+static double2 std_pts_4_5_1d[] = 
+{
+  { -0.77459666924148 /*-sqrt(3.0/5.0)*/,  5.0/9.0 },
+  {  0.0,            8.0/9.0 },
+  {  0.77459666924148 /*sqrt(3.0/5.0)*/,  5.0/9.0 }
+};
+
+static double2 std_pts_6_7_1d[] = 
+{
+  { -0.86113631159405,  0.34785484513745 },
+  { -0.33998104358486,  0.65214515486255 },
+  {  0.33998104358486,  0.65214515486255 },
+  {  0.86113631159405,  0.34785484513745 }
+};
+
+static double2 std_pts_8_9_1d[] = 
+{
+  { -0.90617984593866,  0.23692688505619 },
+  { -0.53846931010568,  0.47862867049937 },
+  {  0.00000000000000,  128.0 / 225.0    },
+  {  0.53846931010568,  0.47862867049937 },
+  {  0.90617984593866,  0.23692688505619 }
+};
+
+static double2 std_pts_10_11_1d[] = 
+{
+  { -0.93246951420315,  0.17132449237917 },
+  { -0.66120938646627,  0.36076157304814 },
+  { -0.23861918608320,  0.46791393457269 },
+  {  0.23861918608320,  0.46791393457269 },
+  {  0.66120938646627,  0.36076157304814 },
+  {  0.93246951420315,  0.17132449237917 }
+};
+
+static double2 std_pts_12_13_1d[] = 
+{
+  { -0.94910791234276,  0.12948496616887 },
+  { -0.74153118559939,  0.27970539148928 },
+  { -0.40584515137740,  0.38183005050512 },
+  {  0.00000000000000,  0.41795918367347 },
+  {  0.40584515137740,  0.38183005050512 },
+  {  0.74153118559939,  0.27970539148928 },
+  {  0.94910791234276,  0.12948496616887 }
+};
+
+static double2 std_pts_14_15_1d[] = 
+{
+  { -0.96028985649754,  0.10122853629038 },
+  { -0.79666647741363,  0.22238103445337 },
+  { -0.52553240991633,  0.31370664587789 },
+  { -0.18343464249565,  0.36268378337836 },
+  {  0.18343464249565,  0.36268378337836 },
+  {  0.52553240991633,  0.31370664587789 },
+  {  0.79666647741363,  0.22238103445337 },
+  {  0.96028985649754,  0.10122853629038 }
+};
+
+static double2 std_pts_16_17_1d[] = 
+{
+  { -0.96816023950763,  0.08127438836157 },
+  { -0.83603110732664,  0.18064816069486 },
+  { -0.61337143270059,  0.26061069640294 },
+  { -0.32425342340381,  0.31234707704000 },
+  {  0.00000000000000,  0.33023935500126 },
+  {  0.32425342340381,  0.31234707704000 },
+  {  0.61337143270059,  0.26061069640294 },
+  {  0.83603110732664,  0.18064816069486 },
+  {  0.96816023950763,  0.08127438836157 }
+};
+
+static double2 std_pts_18_19_1d[] = 
+{
+  { -0.97390652851717,  0.06667134430869 },
+  { -0.86506336668898,  0.14945134915058 },
+  { -0.67940956829902,  0.21908636251598 },
+  { -0.43339539412925,  0.26926671931000 },
+  { -0.14887433898163,  0.29552422471475 },
+  {  0.14887433898163,  0.29552422471475 },
+  {  0.43339539412925,  0.26926671931000 },
+  {  0.67940956829902,  0.21908636251598 },
+  {  0.86506336668898,  0.14945134915058 },
+  {  0.97390652851717,  0.06667134430869 }
+};
+
+static double2 std_pts_20_21_1d[] = 
+{
+  { -0.97822865814606,  0.05566856711617 },
+  { -0.88706259976810,  0.12558036946490 },
+  { -0.73015200557405,  0.18629021092773 },
+  { -0.51909612920681,  0.23319376459199 },
+  { -0.26954315595234,  0.26280454451025 },
+  {  0.00000000000000,  0.27292508677790 },
+  {  0.26954315595234,  0.26280454451025 },
+  {  0.51909612920681,  0.23319376459199 },
+  {  0.73015200557405,  0.18629021092773 },
+  {  0.88706259976810,  0.12558036946490 },
+  {  0.97822865814606,  0.05566856711617 }
+};
+
+static double2 std_pts_22_23_1d[] = 
+{
+  { -0.98156063424672,  0.04717533638651 },
+  { -0.90411725637047,  0.10693932599532 },
+  { -0.76990267419430,  0.16007832854335 },
+  { -0.58731795428662,  0.20316742672307 },
+  { -0.36783149899818,  0.23349253653835 },
+  { -0.12523340851147,  0.24914704581340 },
+  {  0.12523340851147,  0.24914704581340 },
+  {  0.36783149899818,  0.23349253653835 },
+  {  0.58731795428662,  0.20316742672307 },
+  {  0.76990267419430,  0.16007832854335 },
+  {  0.90411725637047,  0.10693932599532 },
+  {  0.98156063424672,  0.04717533638651 }
+};
+
+static double2 std_pts_24_25_1d[] = 
+{
+  { -0.98418305471859,  0.04048400476532 },
+  { -0.91759839922298,  0.09212149983773 },
+  { -0.80157809073331,  0.13887351021979 },
+  { -0.64234933944034,  0.17814598076195 },
+  { -0.44849275103645,  0.20781604753689 },
+  { -0.23045831595513,  0.22628318026290 },
+  {  0.00000000000000,  0.23255155323087 },
+  {  0.23045831595513,  0.22628318026290 },
+  {  0.44849275103645,  0.20781604753689 },
+  {  0.64234933944034,  0.17814598076195 },
+  {  0.80157809073331,  0.13887351021979 },
+  {  0.91759839922298,  0.09212149983773 },
+  {  0.98418305471859,  0.04048400476532 }
+};
+
+static double2 std_pts_26_27_1d[] = 
+{
+  { -0.986283808696812, 0.035119460331751 },
+  { -0.928434883663574, 0.080158087159761 },
+  { -0.827201315069765, 0.121518570687903 },
+  { -0.687292904811685, 0.157203167158193 },
+  { -0.515248636358154, 0.185538397477938 },
+  { -0.319112368927890, 0.205198463721295 },
+  { -0.108054948707344, 0.215263853463158 },
+  { 0.108054948707344, 0.215263853463158 },
+  { 0.319112368927890, 0.205198463721296 },
+  { 0.515248636358154, 0.185538397477938 },
+  { 0.687292904811686, 0.157203167158194 },
+  { 0.827201315069765, 0.121518570687903 },
+  { 0.928434883663574, 0.080158087159761 },
+  { 0.986283808696812, 0.035119460331751 }
+};
+
+static double2 std_pts_28_29_1d[] = 
+{
+  { -0.987992518020485, 0.030753241996117 },
+  { -0.937273392400706, 0.070366047488108 },
+  { -0.848206583410427, 0.107159220467171 },
+  { -0.724417731360170, 0.139570677926155 },
+  { -0.570972172608539, 0.166269205816994 },
+  { -0.394151347077564, 0.186161000015562 },
+  { -0.201194093997434, 0.198431485327112 },
+  { -0.000000000000000, 0.202578241925561 },
+  { 0.201194093997435, 0.198431485327111 },
+  { 0.394151347077563, 0.186161000015562 },
+  { 0.570972172608539, 0.166269205816994 },
+  { 0.724417731360170, 0.139570677926154 },
+  { 0.848206583410428, 0.107159220467173 },
+  { 0.937273392400706, 0.070366047488107 },
+  { 0.987992518020486, 0.030753241996117 }
+};
+
+static double2 std_pts_30_31_1d[] = 
+{
+  { -0.989400934991650, 0.027152459411754 },
+  { -0.944575023073232, 0.062253523938648 },
+  { -0.865631202387831, 0.095158511682493 },
+  { -0.755404408355003, 0.124628971255534 },
+  { -0.617876244402644, 0.149595988816577 },
+  { -0.458016777657227, 0.169156519395003 },
+  { -0.281603550779259, 0.182603415044924 },
+  { -0.095012509837638, 0.189450610455068 },
+  { 0.095012509837637, 0.189450610455069 },
+  { 0.281603550779259, 0.182603415044923 },
+  { 0.458016777657227, 0.169156519395002 },
+  { 0.617876244402644, 0.149595988816576 },
+  { 0.755404408355003, 0.124628971255534 },
+  { 0.865631202387832, 0.095158511682492 },
+  { 0.944575023073233, 0.062253523938648 },
+  { 0.989400934991650, 0.027152459411754 }
+};
+
+static double2 std_pts_32_33_1d[] = 
+{
+  { -0.990575475314418, 0.024148302868548 },
+  { -0.950675521768767, 0.055459529373986 },
+  { -0.880239153726985, 0.085036148317178 },
+  { -0.781514003896801, 0.111883847193404 },
+  { -0.657671159216691, 0.135136368468525 },
+  { -0.512690537086477, 0.154045761076809 },
+  { -0.351231763453876, 0.168004102156450 },
+  { -0.178484181495848, 0.176562705366993 },
+  { -0.000000000000000, 0.179446470356206 },
+  { 0.178484181495848, 0.176562705366992 },
+  { 0.351231763453876, 0.168004102156450 },
+  { 0.512690537086477, 0.154045761076810 },
+  { 0.657671159216691, 0.135136368468525 },
+  { 0.781514003896801, 0.111883847193404 },
+  { 0.880239153726986, 0.085036148317179 },
+  { 0.950675521768767, 0.055459529373989 },
+  { 0.990575475314417, 0.024148302868547 }
+};
+
+static double2 std_pts_34_35_1d[] = 
+{
+  { -0.991565168420931, 0.021616013526482 },
+  { -0.955823949571397, 0.049714548894971 },
+  { -0.892602466497555, 0.076425730254889 },
+  { -0.803704958972523, 0.100942044106288 },
+  { -0.691687043060353, 0.122555206711477 },
+  { -0.559770831073947, 0.140642914670651 },
+  { -0.411751161462843, 0.154684675126265 },
+  { -0.251886225691505, 0.164276483745833 },
+  { -0.084775013041735, 0.169142382963144 },
+  { 0.084775013041735, 0.169142382963144 },
+  { 0.251886225691505, 0.164276483745833 },
+  { 0.411751161462843, 0.154684675126265 },
+  { 0.559770831073948, 0.140642914670651 },
+  { 0.691687043060353, 0.122555206711478 },
+  { 0.803704958972524, 0.100942044106288 },
+  { 0.892602466497555, 0.076425730254889 },
+  { 0.955823949571397, 0.049714548894969 },
+  { 0.991565168420931, 0.021616013526484 }
+};
+
+static double2 std_pts_36_37_1d[] = 
+{
+  { -0.992406843843584, 0.019461788229726 },
+  { -0.960208152134831, 0.044814226765701 },
+  { -0.903155903614818, 0.069044542737641 },
+  { -0.822714656537142, 0.091490021622449 },
+  { -0.720966177335229, 0.111566645547334 },
+  { -0.600545304661682, 0.128753962539337 },
+  { -0.464570741375961, 0.142606702173607 },
+  { -0.316564099963630, 0.152766042065860 },
+  { -0.160358645640225, 0.158968843393954 },
+  { -0.000000000000000, 0.161054449848784 },
+  { 0.160358645640225, 0.158968843393954 },
+  { 0.316564099963630, 0.152766042065859 },
+  { 0.464570741375961, 0.142606702173606 },
+  { 0.600545304661682, 0.128753962539338 },
+  { 0.720966177335230, 0.111566645547334 },
+  { 0.822714656537143, 0.091490021622449 },
+  { 0.903155903614818, 0.069044542737642 },
+  { 0.960208152134830, 0.044814226765701 },
+  { 0.992406843843584, 0.019461788229725 }
+};
+
+static double2 std_pts_38_39_1d[] = 
+{
+  { -0.993128599185094, 0.017614007139151 },
+  { -0.963971927277913, 0.040601429800386 },
+  { -0.912234428251326, 0.062672048334109 },
+  { -0.839116971822218, 0.083276741576704 },
+  { -0.746331906460151, 0.101930119817241 },
+  { -0.636053680726515, 0.118194531961519 },
+  { -0.510867001950827, 0.131688638449177 },
+  { -0.373706088715420, 0.142096109318382 },
+  { -0.227785851141645, 0.149172986472603 },
+  { -0.076526521133497, 0.152753387130726 },
+  { 0.076526521133497, 0.152753387130725 },
+  { 0.227785851141645, 0.149172986472604 },
+  { 0.373706088715420, 0.142096109318382 },
+  { 0.510867001950827, 0.131688638449176 },
+  { 0.636053680726516, 0.118194531961517 },
+  { 0.746331906460151, 0.101930119817241 },
+  { 0.839116971822219, 0.083276741576705 },
+  { 0.912234428251326, 0.062672048334108 },
+  { 0.963971927277914, 0.040601429800388 },
+  { 0.993128599185095, 0.017614007139152 }
+};
+
+static double2 std_pts_40_41_1d[] = 
+{
+  { -0.993752170620389, 0.016017228257775 },
+  { -0.967226838566306, 0.036953789770852 },
+  { -0.920099334150401, 0.057134425426858 },
+  { -0.853363364583317, 0.076100113628379 },
+  { -0.768439963475678, 0.093444423456034 },
+  { -0.667138804197412, 0.108797299167148 },
+  { -0.551618835887220, 0.121831416053728 },
+  { -0.424342120207439, 0.132268938633338 },
+  { -0.288021316802401, 0.139887394791073 },
+  { -0.145561854160895, 0.144524403989970 },
+  { -0.000000000000000, 0.146081133649690 },
+  { 0.145561854160895, 0.144524403989970 },
+  { 0.288021316802401, 0.139887394791073 },
+  { 0.424342120207439, 0.132268938633338 },
+  { 0.551618835887219, 0.121831416053728 },
+  { 0.667138804197412, 0.108797299167148 },
+  { 0.768439963475678, 0.093444423456035 },
+  { 0.853363364583317, 0.076100113628380 },
+  { 0.920099334150401, 0.057134425426856 },
+  { 0.967226838566306, 0.036953789770853 },
+  { 0.993752170620389, 0.016017228257774 }
+};
+
+static double2 std_pts_42_43_1d[] = 
+{
+  { -0.994294585482399, 0.014627995298272 },
+  { -0.970060497835428, 0.033774901584815 },
+  { -0.926956772187173, 0.052293335152683 },
+  { -0.865812577720299, 0.069796468424520 },
+  { -0.787816805979208, 0.085941606217068 },
+  { -0.694487263186683, 0.100414144442880 },
+  { -0.587640403506912, 0.112932296080539 },
+  { -0.469355837986757, 0.123252376810513 },
+  { -0.341935820892084, 0.131173504787062 },
+  { -0.207860426688221, 0.136541498346015 },
+  { -0.069739273319722, 0.139251872855632 },
+  { 0.069739273319722, 0.139251872855632 },
+  { 0.207860426688221, 0.136541498346015 },
+  { 0.341935820892084, 0.131173504787063 },
+  { 0.469355837986757, 0.123252376810512 },
+  { 0.587640403506911, 0.112932296080540 },
+  { 0.694487263186683, 0.100414144442880 },
+  { 0.787816805979209, 0.085941606217068 },
+  { 0.865812577720301, 0.069796468424520 },
+  { 0.926956772187174, 0.052293335152684 },
+  { 0.970060497835429, 0.033774901584815 },
+  { 0.994294585482399, 0.014627995298271 }
+};
+
+static double2 std_pts_44_45_1d[] = 
+{
+  { -0.994769334997552, 0.013411859487142 },
+  { -0.972542471218116, 0.030988005856980 },
+  { -0.932971086826016, 0.048037671731084 },
+  { -0.876752358270442, 0.064232421408525 },
+  { -0.804888401618840, 0.079281411776720 },
+  { -0.718661363131951, 0.092915766060036 },
+  { -0.619609875763646, 0.104892091464541 },
+  { -0.509501477846008, 0.114996640222412 },
+  { -0.390301038030291, 0.123049084306730 },
+  { -0.264135680970345, 0.128905722188083 },
+  { -0.133256824298467, 0.132462039404696 },
+  { 0.000000000000000, 0.133654572186107 },
+  { 0.133256824298466, 0.132462039404697 },
+  { 0.264135680970345, 0.128905722188082 },
+  { 0.390301038030291, 0.123049084306730 },
+  { 0.509501477846008, 0.114996640222412 },
+  { 0.619609875763646, 0.104892091464541 },
+  { 0.718661363131950, 0.092915766060034 },
+  { 0.804888401618840, 0.079281411776720 },
+  { 0.876752358270442, 0.064232421408525 },
+  { 0.932971086826016, 0.048037671731084 },
+  { 0.972542471218116, 0.030988005856980 },
+  { 0.994769334997553, 0.013411859487142 }
+};
+
+static double2 std_pts_46_47_1d[] = 
+{
+  { -0.995187219997022, 0.012341229799987 },
+  { -0.974728555971309, 0.028531388628934 },
+  { -0.938274552002733, 0.044277438817420 },
+  { -0.886415527004401, 0.059298584915435 },
+  { -0.820001985973903, 0.073346481411081 },
+  { -0.740124191578555, 0.086190161531954 },
+  { -0.648093651936975, 0.097618652104113 },
+  { -0.545421471388839, 0.107444270115966 },
+  { -0.433793507626045, 0.115505668053726 },
+  { -0.315042679696163, 0.121670472927803 },
+  { -0.191118867473616, 0.125837456346829 },
+  { -0.064056892862606, 0.127938195346752 },
+  { 0.064056892862606, 0.127938195346752 },
+  { 0.191118867473616, 0.125837456346828 },
+  { 0.315042679696163, 0.121670472927804 },
+  { 0.433793507626045, 0.115505668053725 },
+  { 0.545421471388839, 0.107444270115966 },
+  { 0.648093651936975, 0.097618652104114 },
+  { 0.740124191578554, 0.086190161531953 },
+  { 0.820001985973903, 0.073346481411080 },
+  { 0.886415527004401, 0.059298584915438 },
+  { 0.938274552002732, 0.044277438817420 },
+  { 0.974728555971309, 0.028531388628932 },
+  { 0.995187219997021, 0.012341229799989 }
+};
+
+static double2 std_pts_48_49_1d[] = 
+{
+  { -0.995556969790498, 0.011393798501027 },
+  { -0.976663921459517, 0.026354986615031 },
+  { -0.942974571228975, 0.040939156701306 },
+  { -0.894991997878275, 0.054904695975835 },
+  { -0.833442628760833, 0.068038333812356 },
+  { -0.759259263037358, 0.080140700335002 },
+  { -0.673566368473468, 0.091028261982963 },
+  { -0.577662930241223, 0.100535949067050 },
+  { -0.473002731445715, 0.108519624474263 },
+  { -0.361172305809388, 0.114858259145712 },
+  { -0.243866883720988, 0.119455763535785 },
+  { -0.122864692610710, 0.122242442990310 },
+  { 0.000000000000000, 0.123176053726715 },
+  { 0.122864692610710, 0.122242442990310 },
+  { 0.243866883720988, 0.119455763535784 },
+  { 0.361172305809388, 0.114858259145712 },
+  { 0.473002731445715, 0.108519624474264 },
+  { 0.577662930241223, 0.100535949067051 },
+  { 0.673566368473468, 0.091028261982963 },
+  { 0.759259263037358, 0.080140700335002 },
+  { 0.833442628760834, 0.068038333812356 },
+  { 0.894991997878275, 0.054904695975836 },
+  { 0.942974571228975, 0.040939156701306 },
+  { 0.976663921459517, 0.026354986615033 },
+  { 0.995556969790499, 0.011393798501026 }
+};
+
+static double2 std_pts_50_51_1d[] = 
+{
+  { -0.995885701145617, 0.010551372617343 },
+  { -0.978385445956472, 0.024417851092632 },
+  { -0.947159066661714, 0.037962383294362 },
+  { -0.902637861984308, 0.050975825297148 },
+  { -0.845445942788498, 0.063274046329575 },
+  { -0.776385948820679, 0.074684149765660 },
+  { -0.696427260419958, 0.085045894313486 },
+  { -0.606692293017619, 0.094213800355913 },
+  { -0.508440714824505, 0.102059161094425 },
+  { -0.403051755123486, 0.108471840528577 },
+  { -0.292004839485957, 0.113361816546320 },
+  { -0.176858820356890, 0.116660443485297 },
+  { -0.059230093429313, 0.118321415279263 },
+  { 0.059230093429313, 0.118321415279262 },
+  { 0.176858820356890, 0.116660443485297 },
+  { 0.292004839485957, 0.113361816546319 },
+  { 0.403051755123487, 0.108471840528577 },
+  { 0.508440714824506, 0.102059161094425 },
+  { 0.606692293017619, 0.094213800355914 },
+  { 0.696427260419958, 0.085045894313485 },
+  { 0.776385948820679, 0.074684149765660 },
+  { 0.845445942788498, 0.063274046329574 },
+  { 0.902637861984306, 0.050975825297148 },
+  { 0.947159066661713, 0.037962383294363 },
+  { 0.978385445956472, 0.024417851092633 },
+  { 0.995885701145617, 0.010551372617343 }
+};
+
+static double2 std_pts_52_53_1d[] = 
+{
+  { -0.996179262888989, 0.009798996051295 },
+  { -0.979923475961501, 0.022686231596180 },
+  { -0.950900557814705, 0.035297053757420 },
+  { -0.909482320677491, 0.047449412520615 },
+  { -0.856207908018294, 0.058983536859833 },
+  { -0.791771639070508, 0.069748823766245 },
+  { -0.717013473739424, 0.079604867773057 },
+  { -0.632907971946495, 0.088423158543758 },
+  { -0.540551564579457, 0.096088727370028 },
+  { -0.441148251750027, 0.102501637817746 },
+  { -0.335993903638509, 0.107578285788533 },
+  { -0.226459365439537, 0.111252488356845 },
+  { -0.113972585609530, 0.113476346108965 },
+  { -0.000000000000000, 0.114220867378957 },
+  { 0.113972585609530, 0.113476346108965 },
+  { 0.226459365439537, 0.111252488356845 },
+  { 0.335993903638509, 0.107578285788533 },
+  { 0.441148251750027, 0.102501637817747 },
+  { 0.540551564579457, 0.096088727370029 },
+  { 0.632907971946495, 0.088423158543757 },
+  { 0.717013473739423, 0.079604867773058 },
+  { 0.791771639070508, 0.069748823766244 },
+  { 0.856207908018295, 0.058983536859834 },
+  { 0.909482320677491, 0.047449412520615 },
+  { 0.950900557814705, 0.035297053757421 },
+  { 0.979923475961501, 0.022686231596181 },
+  { 0.996179262888989, 0.009798996051294 }
+};
+
+static double2 std_pts_54_55_1d[] = 
+{
+  { -0.996442497573954, 0.009124282593095 },
+  { -0.981303165370874, 0.021132112592770 },
+  { -0.954259280628938, 0.032901427782305 },
+  { -0.915633026392131, 0.044272934759003 },
+  { -0.865892522574395, 0.055107345675717 },
+  { -0.805641370917180, 0.065272923967001 },
+  { -0.735610878013631, 0.074646214234569 },
+  { -0.656651094038865, 0.083113417228901 },
+  { -0.569720471811402, 0.090571744393032 },
+  { -0.475874224955118, 0.096930657997930 },
+  { -0.376251516089079, 0.102112967578061 },
+  { -0.272061627635178, 0.106055765922847 },
+  { -0.164569282133381, 0.108711192258294 },
+  { -0.055079289884034, 0.110047013016475 },
+  { 0.055079289884034, 0.110047013016475 },
+  { 0.164569282133381, 0.108711192258294 },
+  { 0.272061627635178, 0.106055765922847 },
+  { 0.376251516089078, 0.102112967578061 },
+  { 0.475874224955118, 0.096930657997930 },
+  { 0.569720471811402, 0.090571744393033 },
+  { 0.656651094038865, 0.083113417228900 },
+  { 0.735610878013633, 0.074646214234570 },
+  { 0.805641370917179, 0.065272923966999 },
+  { 0.865892522574395, 0.055107345675717 },
+  { 0.915633026392131, 0.044272934759003 },
+  { 0.954259280628938, 0.032901427782304 },
+  { 0.981303165370873, 0.021132112592771 },
+  { 0.996442497573955, 0.009124282593096 }
+};
+
+static double2 std_pts_56_57_1d[] = 
+{
+  { -0.996679442260596, 0.008516903878746 },
+  { -0.982545505261413, 0.019732085056122 },
+  { -0.957285595778087, 0.030740492202093 },
+  { -0.921180232953059, 0.041402062518684 },
+  { -0.874637804920103, 0.051594826902498 },
+  { -0.818185487615253, 0.061203090657079 },
+  { -0.752462851734477, 0.070117933255052 },
+  { -0.678214537602687, 0.078238327135764 },
+  { -0.596281797138228, 0.085472257366172 },
+  { -0.507592955124228, 0.091737757139259 },
+  { -0.413152888174009, 0.096963834094409 },
+  { -0.314031637867640, 0.101091273759915 },
+  { -0.211352286166001, 0.104073310077730 },
+  { -0.106278230132679, 0.105876155097321 },
+  { -0.000000000000000, 0.106479381718314 },
+  { 0.106278230132679, 0.105876155097321 },
+  { 0.211352286166001, 0.104073310077730 },
+  { 0.314031637867640, 0.101091273759915 },
+  { 0.413152888174009, 0.096963834094408 },
+  { 0.507592955124228, 0.091737757139259 },
+  { 0.596281797138228, 0.085472257366173 },
+  { 0.678214537602687, 0.078238327135764 },
+  { 0.752462851734478, 0.070117933255052 },
+  { 0.818185487615252, 0.061203090657080 },
+  { 0.874637804920103, 0.051594826902498 },
+  { 0.921180232953059, 0.041402062518683 },
+  { 0.957285595778087, 0.030740492202093 },
+  { 0.982545505261413, 0.019732085056123 },
+  { 0.996679442260596, 0.008516903878746 }
+};
+
+static double2 std_pts_58_59_1d[] = 
+{
+  { -0.996893484074650, 0.007968192496168 },
+  { -0.983668123279747, 0.018466468311090 },
+  { -0.960021864968307, 0.028784707883324 },
+  { -0.926200047429274, 0.038799192569626 },
+  { -0.882560535792052, 0.048402672830594 },
+  { -0.829565762382769, 0.057493156217620 },
+  { -0.767777432104826, 0.065974229882180 },
+  { -0.697850494793316, 0.073755974737705 },
+  { -0.620526182989243, 0.080755895229421 },
+  { -0.536624148142020, 0.086899787201083 },
+  { -0.447033769538089, 0.092122522237786 },
+  { -0.352704725530878, 0.096368737174644 },
+  { -0.254636926167890, 0.099593420586795 },
+  { -0.153869913608583, 0.101762389748406 },
+  { -0.051471842555318, 0.102852652893559 },
+  { 0.051471842555318, 0.102852652893559 },
+  { 0.153869913608584, 0.101762389748405 },
+  { 0.254636926167890, 0.099593420586796 },
+  { 0.352704725530878, 0.096368737174645 },
+  { 0.447033769538089, 0.092122522237787 },
+  { 0.536624148142019, 0.086899787201082 },
+  { 0.620526182989243, 0.080755895229420 },
+  { 0.697850494793316, 0.073755974737705 },
+  { 0.767777432104827, 0.065974229882181 },
+  { 0.829565762382768, 0.057493156217619 },
+  { 0.882560535792052, 0.048402672830595 },
+  { 0.926200047429274, 0.038799192569626 },
+  { 0.960021864968307, 0.028784707883323 },
+  { 0.983668123279747, 0.018466468311093 },
+  { 0.996893484074650, 0.007968192496166 }
+};
+
+static double2 std_pts_60_61_1d[] = 
+{
+  { -0.997087481819477, 0.007470831579248 },
+  { -0.984685909665153, 0.017318620790311 },
+  { -0.962503925092950, 0.027009019184980 },
+  { -0.930756997896648, 0.036432273912386 },
+  { -0.889760029948271, 0.045493707527201 },
+  { -0.839920320146268, 0.054103082424916 },
+  { -0.781733148416626, 0.062174786561029 },
+  { -0.715776784586853, 0.069628583235410 },
+  { -0.642706722924260, 0.076390386598777 },
+  { -0.563249161407150, 0.082392991761589 },
+  { -0.478193782044902, 0.087576740608478 },
+  { -0.388385901608233, 0.091890113893641 },
+  { -0.294718069981702, 0.095290242912320 },
+  { -0.198121199335571, 0.097743335386329 },
+  { -0.099555312152342, 0.099225011226672 },
+  { -0.000000000000000, 0.099720544793426 },
+  { 0.099555312152342, 0.099225011226672 },
+  { 0.198121199335571, 0.097743335386329 },
+  { 0.294718069981701, 0.095290242912320 },
+  { 0.388385901608233, 0.091890113893642 },
+  { 0.478193782044902, 0.087576740608478 },
+  { 0.563249161407149, 0.082392991761588 },
+  { 0.642706722924260, 0.076390386598777 },
+  { 0.715776784586853, 0.069628583235410 },
+  { 0.781733148416625, 0.062174786561029 },
+  { 0.839920320146268, 0.054103082424918 },
+  { 0.889760029948271, 0.045493707527202 },
+  { 0.930756997896648, 0.036432273912386 },
+  { 0.962503925092949, 0.027009019184978 },
+  { 0.984685909665152, 0.017318620790310 },
+  { 0.997087481819477, 0.007470831579249 }
+};
+
+static double2 std_pts_62_63_1d[] = 
+{
+  { -0.997263861849481, 0.007018610009469 },
+  { -0.985611511545268, 0.016274394730905 },
+  { -0.964762255587506, 0.025392065309263 },
+  { -0.934906075937740, 0.034273862913020 },
+  { -0.896321155766051, 0.042835898022228 },
+  { -0.849367613732569, 0.050998059262375 },
+  { -0.794483795967942, 0.058684093478534 },
+  { -0.732182118740289, 0.065822222776362 },
+  { -0.663044266930215, 0.072345794108849 },
+  { -0.587715757240763, 0.078193895787070 },
+  { -0.506899908932230, 0.083311924226947 },
+  { -0.421351276130635, 0.087652093004404 },
+  { -0.331868602282128, 0.091173878695764 },
+  { -0.239287362252137, 0.093844399080804 },
+  { -0.144471961582797, 0.095638720079275 },
+  { -0.048307665687738, 0.096540088514728 },
+  { 0.048307665687738, 0.096540088514728 },
+  { 0.144471961582797, 0.095638720079275 },
+  { 0.239287362252137, 0.093844399080805 },
+  { 0.331868602282128, 0.091173878695764 },
+  { 0.421351276130635, 0.087652093004404 },
+  { 0.506899908932230, 0.083311924226946 },
+  { 0.587715757240763, 0.078193895787071 },
+  { 0.663044266930215, 0.072345794108848 },
+  { 0.732182118740290, 0.065822222776363 },
+  { 0.794483795967942, 0.058684093478537 },
+  { 0.849367613732570, 0.050998059262376 },
+  { 0.896321155766052, 0.042835898022226 },
+  { 0.934906075937739, 0.034273862913021 },
+  { 0.964762255587506, 0.025392065309263 },
+  { 0.985611511545267, 0.016274394730905 },
+  { 0.997263861849481, 0.007018610009471 }
+};
+
+static double2 std_pts_64_65_1d[] = 
+{
+  { -0.997424694246456, 0.006606227847588 },
+  { -0.986455726230643, 0.015321701512936 },
+  { -0.966822909689993, 0.023915548101749 },
+  { -0.938694372611168, 0.032300358632328 },
+  { -0.902316767743434, 0.040401541331670 },
+  { -0.858009652676504, 0.048147742818711 },
+  { -0.806162356274167, 0.055470846631663 },
+  { -0.747230496449563, 0.062306482530318 },
+  { -0.681731959969743, 0.068594572818657 },
+  { -0.610242345836379, 0.074279854843955 },
+  { -0.533389904786348, 0.079312364794886 },
+  { -0.451850017272451, 0.083647876067039 },
+  { -0.366339257748073, 0.087248287618844 },
+  { -0.277609097152497, 0.090081958660639 },
+  { -0.186439298827992, 0.092123986643317 },
+  { -0.093631065854733, 0.093356426065596 },
+  { 0.000000000000000, 0.093768446160210 },
+  { 0.093631065854734, 0.093356426065596 },
+  { 0.186439298827991, 0.092123986643317 },
+  { 0.277609097152497, 0.090081958660639 },
+  { 0.366339257748073, 0.087248287618844 },
+  { 0.451850017272450, 0.083647876067039 },
+  { 0.533389904786348, 0.079312364794887 },
+  { 0.610242345836379, 0.074279854843954 },
+  { 0.681731959969742, 0.068594572818658 },
+  { 0.747230496449563, 0.062306482530319 },
+  { 0.806162356274167, 0.055470846631662 },
+  { 0.858009652676505, 0.048147742818712 },
+  { 0.902316767743434, 0.040401541331670 },
+  { 0.938694372611168, 0.032300358632327 },
+  { 0.966822909689992, 0.023915548101750 },
+  { 0.986455726230643, 0.015321701512936 },
+  { 0.997424694246456, 0.006606227847587 }
+};
+
+static double2 std_pts_66_67_1d[] = 
+{
+  { -0.997571753790842, 0.006229140555909 },
+  { -0.987227816406309, 0.014450162748594 },
+  { -0.968708262533344, 0.022563721985495 },
+  { -0.942162397405107, 0.030491380638446 },
+  { -0.907809677718324, 0.038166593796387 },
+  { -0.865934638334565, 0.045525611523354 },
+  { -0.816884227900933, 0.052507414572679 },
+  { -0.761064876629873, 0.059054135827525 },
+  { -0.698939113216264, 0.065111521554076 },
+  { -0.631021727080529, 0.070629375814256 },
+  { -0.557875500669747, 0.075561974660032 },
+  { -0.480106545190327, 0.079868444339772 },
+  { -0.398359277758646, 0.083513099699846 },
+  { -0.313311081339463, 0.086465739747036 },
+  { -0.225666691616450, 0.088701897835694 },
+  { -0.136152357259183, 0.090203044370641 },
+  { -0.045509821953103, 0.090956740330260 },
+  { 0.045509821953103, 0.090956740330260 },
+  { 0.136152357259183, 0.090203044370641 },
+  { 0.225666691616450, 0.088701897835694 },
+  { 0.313311081339463, 0.086465739747036 },
+  { 0.398359277758646, 0.083513099699846 },
+  { 0.480106545190327, 0.079868444339772 },
+  { 0.557875500669747, 0.075561974660032 },
+  { 0.631021727080528, 0.070629375814256 },
+  { 0.698939113216263, 0.065111521554077 },
+  { 0.761064876629873, 0.059054135827524 },
+  { 0.816884227900934, 0.052507414572678 },
+  { 0.865934638334565, 0.045525611523352 },
+  { 0.907809677718325, 0.038166593796389 },
+  { 0.942162397405108, 0.030491380638447 },
+  { 0.968708262533344, 0.022563721985496 },
+  { 0.987227816406309, 0.014450162748595 },
+  { 0.997571753790842, 0.006229140555908 }
+};
+
+static double2 std_pts_68_69_1d[] = 
+{
+  { -0.997706569099601, 0.005883433420444 },
+  { -0.987935764443852, 0.013650828348360 },
+  { -0.970437616039230, 0.021322979911484 },
+  { -0.945345148207827, 0.028829260108895 },
+  { -0.912854261359317, 0.036110115863463 },
+  { -0.873219125025222, 0.043108422326170 },
+  { -0.826749899092226, 0.049769370401354 },
+  { -0.773810252286913, 0.056040816212370 },
+  { -0.714814501556630, 0.061873671966081 },
+  { -0.650224364665890, 0.067222285269086 },
+  { -0.580545344749764, 0.072044794772560 },
+  { -0.506322773241489, 0.076303457155443 },
+  { -0.428137541517815, 0.079964942242324 },
+  { -0.346601554430814, 0.083000593728857 },
+  { -0.262352941209296, 0.085386653392099 },
+  { -0.176051061165990, 0.087104446997184 },
+  { -0.088371343275659, 0.088140530430276 },
+  { -0.000000000000000, 0.088486794907105 },
+  { 0.088371343275659, 0.088140530430275 },
+  { 0.176051061165990, 0.087104446997183 },
+  { 0.262352941209296, 0.085386653392099 },
+  { 0.346601554430814, 0.083000593728857 },
+  { 0.428137541517814, 0.079964942242325 },
+  { 0.506322773241488, 0.076303457155442 },
+  { 0.580545344749764, 0.072044794772560 },
+  { 0.650224364665891, 0.067222285269088 },
+  { 0.714814501556628, 0.061873671966080 },
+  { 0.773810252286913, 0.056040816212371 },
+  { 0.826749899092225, 0.049769370401352 },
+  { 0.873219125025222, 0.043108422326170 },
+  { 0.912854261359318, 0.036110115863465 },
+  { 0.945345148207826, 0.028829260108894 },
+  { 0.970437616039230, 0.021322979911485 },
+  { 0.987935764443852, 0.013650828348361 },
+  { 0.997706569099601, 0.005883433420442 }
+};
+
+static double2 std_pts_70_71_1d[] = 
+{
+  { -0.997830462484085, 0.005565719664244 },
+  { -0.988586478902211, 0.012915947284065 },
+  { -0.972027691049697, 0.020181515297736 },
+  { -0.948272984399506, 0.027298621498568 },
+  { -0.917497774515659, 0.034213810770308 },
+  { -0.879929800890396, 0.040875750923645 },
+  { -0.835847166992475, 0.047235083490267 },
+  { -0.785576230132207, 0.053244713977760 },
+  { -0.729489171593556, 0.058860144245324 },
+  { -0.668001236585521, 0.064039797355016 },
+  { -0.601567658135980, 0.068745323835736 },
+  { -0.530680285926245, 0.072941885005653 },
+  { -0.455863944433420, 0.076598410645870 },
+  { -0.377672547119689, 0.079687828912072 },
+  { -0.296684995344028, 0.082187266704340 },
+  { -0.213500892316866, 0.084078218979662 },
+  { -0.128736103809385, 0.085346685739339 },
+  { -0.043018198473709, 0.085983275670394 },
+  { 0.043018198473709, 0.085983275670395 },
+  { 0.128736103809385, 0.085346685739339 },
+  { 0.213500892316865, 0.084078218979662 },
+  { 0.296684995344028, 0.082187266704340 },
+  { 0.377672547119689, 0.079687828912071 },
+  { 0.455863944433420, 0.076598410645870 },
+  { 0.530680285926244, 0.072941885005652 },
+  { 0.601567658135981, 0.068745323835738 },
+  { 0.668001236585520, 0.064039797355016 },
+  { 0.729489171593557, 0.058860144245326 },
+  { 0.785576230132206, 0.053244713977758 },
+  { 0.835847166992474, 0.047235083490264 },
+  { 0.879929800890398, 0.040875750923646 },
+  { 0.917497774515660, 0.034213810770308 },
+  { 0.948272984399508, 0.027298621498570 },
+  { 0.972027691049699, 0.020181515297736 },
+  { 0.988586478902212, 0.012915947284065 },
+  { 0.997830462484087, 0.005565719664245 }
+};
+
+static double2 std_pts_72_73_1d[] = 
+{
+  { -0.997944582477914, 0.005273057279500 },
+  { -0.989185963214319, 0.012238780100307 },
+  { -0.973493030056486, 0.019129044489083 },
+  { -0.950972343262094, 0.025886036990559 },
+  { -0.921781437412463, 0.032461639847522 },
+  { -0.886124962155487, 0.038809602501935 },
+  { -0.844252987340556, 0.044885364662437 },
+  { -0.796459200509902, 0.050646297654825 },
+  { -0.743078833981965, 0.056051987998274 },
+  { -0.684486309130960, 0.061064516523226 },
+  { -0.621092608408925, 0.065648722872752 },
+  { -0.553342391861582, 0.069772451555700 },
+  { -0.481710877803206, 0.073406777248488 },
+  { -0.406700509318326, 0.076526207570529 },
+  { -0.328837429883707, 0.079108861837529 },
+  { -0.248667792791366, 0.081136624508465 },
+  { -0.166753930239852, 0.082595272236438 },
+  { -0.083670408954770, 0.083474573625863 },
+  { 0.000000000000000, 0.083768360993139 },
+  { 0.083670408954770, 0.083474573625863 },
+  { 0.166753930239852, 0.082595272236438 },
+  { 0.248667792791366, 0.081136624508465 },
+  { 0.328837429883707, 0.079108861837529 },
+  { 0.406700509318326, 0.076526207570530 },
+  { 0.481710877803205, 0.073406777248488 },
+  { 0.553342391861582, 0.069772451555701 },
+  { 0.621092608408924, 0.065648722872752 },
+  { 0.684486309130959, 0.061064516523226 },
+  { 0.743078833981966, 0.056051987998275 },
+  { 0.796459200509902, 0.050646297654826 },
+  { 0.844252987340556, 0.044885364662437 },
+  { 0.886124962155486, 0.038809602501933 },
+  { 0.921781437412463, 0.032461639847522 },
+  { 0.950972343262095, 0.025886036990559 },
+  { 0.973493030056486, 0.019129044489083 },
+  { 0.989185963214320, 0.012238780100308 },
+  { 0.997944582477914, 0.005273057279499 }
+};
+
+static double2 std_pts_74_75_1d[] = 
+{
+  { -0.998049930535688, 0.005002880749638 },
+  { -0.989739454266385, 0.011613444716469 },
+  { -0.974846328590153, 0.018156577709614 },
+  { -0.953466330933529, 0.024579739738233 },
+  { -0.925741332048584, 0.030839500545174 },
+  { -0.891855739004633, 0.036894081594025 },
+  { -0.852035021932362, 0.042703158504674 },
+  { -0.806544167605317, 0.048228061860759 },
+  { -0.755685903753970, 0.053432019910332 },
+  { -0.699798680379184, 0.058280399146997 },
+  { -0.639254415829682, 0.062740933392132 },
+  { -0.574456021047807, 0.066783937979141 },
+  { -0.505834717927931, 0.070382507066899 },
+  { -0.433847169432377, 0.073512692584744 },
+  { -0.358972440479435, 0.076153663548447 },
+  { -0.281708809790165, 0.078287844658211 },
+  { -0.202570453892117, 0.079901033243528 },
+  { -0.122084025337867, 0.080982493770597 },
+  { -0.040785147904578, 0.081525029280386 },
+  { 0.040785147904578, 0.081525029280386 },
+  { 0.122084025337867, 0.080982493770597 },
+  { 0.202570453892116, 0.079901033243527 },
+  { 0.281708809790165, 0.078287844658210 },
+  { 0.358972440479435, 0.076153663548447 },
+  { 0.433847169432376, 0.073512692584743 },
+  { 0.505834717927931, 0.070382507066899 },
+  { 0.574456021047807, 0.066783937979140 },
+  { 0.639254415829682, 0.062740933392133 },
+  { 0.699798680379184, 0.058280399146996 },
+  { 0.755685903753970, 0.053432019910331 },
+  { 0.806544167605317, 0.048228061860758 },
+  { 0.852035021932362, 0.042703158504674 },
+  { 0.891855739004632, 0.036894081594025 },
+  { 0.925741332048585, 0.030839500545175 },
+  { 0.953466330933530, 0.024579739738232 },
+  { 0.974846328590153, 0.018156577709615 },
+  { 0.989739454266386, 0.011613444716467 },
+  { 0.998049930535688, 0.005002880749640 }
+};
+
+static double2 std_pts_76_77_1d[] = 
+{
+  { -0.998147383066434, 0.004752944691637 },
+  { -0.990251536854686, 0.011034788939163 },
+  { -0.976098709333471, 0.017256229093725 },
+  { -0.955775212324652, 0.023369384832178 },
+  { -0.929409148486737, 0.029334955983903 },
+  { -0.897167119292993, 0.035115111498129 },
+  { -0.859252937999906, 0.040673276847935 },
+  { -0.815906297430143, 0.045974301108917 },
+  { -0.767401242931063, 0.050984665292129 },
+  { -0.714044435894535, 0.055672690340916 },
+  { -0.656173213432011, 0.060008736088596 },
+  { -0.594153454957278, 0.063965388138682 },
+  { -0.528377268660437, 0.067517630966232 },
+  { -0.459260512309136, 0.070643005970609 },
+  { -0.387240163971561, 0.073321753414269 },
+  { -0.312771559248186, 0.075536937322836 },
+  { -0.236325512461836, 0.077274552544682 },
+  { -0.158385339997838, 0.078523613287371 },
+  { -0.079443804608755, 0.079276222568368 },
+  { -0.000000000000000, 0.079527622139443 },
+  { 0.079443804608756, 0.079276222568369 },
+  { 0.158385339997838, 0.078523613287371 },
+  { 0.236325512461836, 0.077274552544682 },
+  { 0.312771559248186, 0.075536937322836 },
+  { 0.387240163971562, 0.073321753414269 },
+  { 0.459260512309136, 0.070643005970610 },
+  { 0.528377268660437, 0.067517630966231 },
+  { 0.594153454957278, 0.063965388138683 },
+  { 0.656173213432012, 0.060008736088596 },
+  { 0.714044435894535, 0.055672690340917 },
+  { 0.767401242931063, 0.050984665292130 },
+  { 0.815906297430143, 0.045974301108917 },
+  { 0.859252937999906, 0.040673276847934 },
+  { 0.897167119292992, 0.035115111498130 },
+  { 0.929409148486738, 0.029334955983903 },
+  { 0.955775212324652, 0.023369384832178 },
+  { 0.976098709333471, 0.017256229093725 },
+  { 0.990251536854686, 0.011034788939166 },
+  { 0.998147383066433, 0.004752944691636 }
+};
+
+static double2 std_pts_78_79_1d[] = 
+{
+  { -0.998237709710559, 0.004521277098533 },
+  { -0.990726238699457, 0.010498284531154 },
+  { -0.977259949983774, 0.016421058381907 },
+  { -0.957916819213790, 0.022245849194166 },
+  { -0.932812808278677, 0.027937006980024 },
+  { -0.902098806968874, 0.033460195282548 },
+  { -0.865959503212260, 0.038782167974472 },
+  { -0.824612230833311, 0.043870908185673 },
+  { -0.778305651426519, 0.048695807635073 },
+  { -0.727318255189927, 0.053227846983938 },
+  { -0.671956684614180, 0.057439769099392 },
+  { -0.612553889667980, 0.061306242492929 },
+  { -0.549467125095129, 0.064804013456601 },
+  { -0.483075801686179, 0.067912045815233 },
+  { -0.413779204371605, 0.070611647391287 },
+  { -0.341994090825759, 0.072886582395805 },
+  { -0.268152185007254, 0.074723169057968 },
+  { -0.192697580701371, 0.076110361900627 },
+  { -0.116084070675255, 0.077039818164248 },
+  { -0.038772417506051, 0.077505947978425 },
+  { 0.038772417506051, 0.077505947978425 },
+  { 0.116084070675255, 0.077039818164248 },
+  { 0.192697580701371, 0.076110361900627 },
+  { 0.268152185007254, 0.074723169057968 },
+  { 0.341994090825759, 0.072886582395805 },
+  { 0.413779204371604, 0.070611647391286 },
+  { 0.483075801686179, 0.067912045815234 },
+  { 0.549467125095128, 0.064804013456601 },
+  { 0.612553889667980, 0.061306242492930 },
+  { 0.671956684614179, 0.057439769099390 },
+  { 0.727318255189926, 0.053227846983936 },
+  { 0.778305651426520, 0.048695807635073 },
+  { 0.824612230833311, 0.043870908185674 },
+  { 0.865959503212260, 0.038782167974473 },
+  { 0.902098806968875, 0.033460195282547 },
+  { 0.932812808278676, 0.027937006980023 },
+  { 0.957916819213791, 0.022245849194166 },
+  { 0.977259949983774, 0.016421058381908 },
+  { 0.990726238699457, 0.010498284531154 },
+  { 0.998237709710559, 0.004521277098534 }
+};
+
+static double2 std_pts_80_81_1d[] = 
+{
+  { -0.998321588574771, 0.004306140358166 },
+  { -0.991167109699016, 0.009999938773907 },
+  { -0.978338673561084, 0.015644938407818 },
+  { -0.959906891730346, 0.021201063368778 },
+  { -0.935976987497853, 0.026635899207111 },
+  { -0.906685944758102, 0.031918211731698 },
+  { -0.872201511692441, 0.037017716703509 },
+  { -0.832721200401361, 0.041905195195909 },
+  { -0.788471145047409, 0.046552648369014 },
+  { -0.739704803069926, 0.050933454294617 },
+  { -0.686701502034952, 0.055022519242579 },
+  { -0.629764839072196, 0.058796420949872 },
+  { -0.569220941610216, 0.062233542580967 },
+  { -0.505416599199406, 0.065314196453527 },
+  { -0.438717277051407, 0.068020736760877 },
+  { -0.369505022640482, 0.070337660620817 },
+  { -0.298176277341825, 0.072251696861023 },
+  { -0.225139605633423, 0.073751882027224 },
+  { -0.150813354863992, 0.074829623176221 },
+  { -0.075623258989163, 0.075478747092715 },
+  { -0.000000000000000, 0.075695535647298 },
+  { 0.075623258989163, 0.075478747092715 },
+  { 0.150813354863992, 0.074829623176221 },
+  { 0.225139605633423, 0.073751882027223 },
+  { 0.298176277341825, 0.072251696861023 },
+  { 0.369505022640482, 0.070337660620818 },
+  { 0.438717277051407, 0.068020736760877 },
+  { 0.505416599199406, 0.065314196453527 },
+  { 0.569220941610216, 0.062233542580966 },
+  { 0.629764839072196, 0.058796420949871 },
+  { 0.686701502034952, 0.055022519242578 },
+  { 0.739704803069927, 0.050933454294620 },
+  { 0.788471145047410, 0.046552648369013 },
+  { 0.832721200401362, 0.041905195195910 },
+  { 0.872201511692442, 0.037017716703506 },
+  { 0.906685944758102, 0.031918211731700 },
+  { 0.935976987497854, 0.026635899207111 },
+  { 0.959906891730346, 0.021201063368780 },
+  { 0.978338673561084, 0.015644938407818 },
+  { 0.991167109699017, 0.009999938773906 },
+  { 0.998321588574772, 0.004306140358166 }
+};
+
+static double2 std_pts_82_83_1d[] = 
+{
+  { -0.998399618990063, 0.004105998604650 },
+  { -0.991577288340861, 0.009536220301747 },
+  { -0.979342508063748, 0.014922443697358 },
+  { -0.961759365338204, 0.020227869569052 },
+  { -0.938923557354989, 0.025422959526113 },
+  { -0.910959724904128, 0.030479240699603 },
+  { -0.878020569812174, 0.035369071097593 },
+  { -0.840285983261816, 0.040065735180692 },
+  { -0.797962053255488, 0.044543577771966 },
+  { -0.751279935689482, 0.048778140792805 },
+  { -0.700494590556173, 0.052746295699176 },
+  { -0.645883388869248, 0.056426369358017 },
+  { -0.587744597485109, 0.059798262227586 },
+  { -0.526395749931192, 0.062843558045002 },
+  { -0.462171912070422, 0.065545624364910 },
+  { -0.395423852042975, 0.067889703376523 },
+  { -0.326516124465412, 0.069862992492594 },
+  { -0.255825079342879, 0.071454714265171 },
+  { -0.183736806564855, 0.072656175243804 },
+  { -0.110645027208520, 0.073460813453468 },
+  { -0.036948943165352, 0.073864234232173 },
+  { 0.036948943165352, 0.073864234232173 },
+  { 0.110645027208520, 0.073460813453467 },
+  { 0.183736806564855, 0.072656175243805 },
+  { 0.255825079342879, 0.071454714265170 },
+  { 0.326516124465412, 0.069862992492594 },
+  { 0.395423852042975, 0.067889703376523 },
+  { 0.462171912070422, 0.065545624364908 },
+  { 0.526395749931193, 0.062843558045003 },
+  { 0.587744597485109, 0.059798262227587 },
+  { 0.645883388869248, 0.056426369358019 },
+  { 0.700494590556171, 0.052746295699173 },
+  { 0.751279935689481, 0.048778140792805 },
+  { 0.797962053255487, 0.044543577771966 },
+  { 0.840285983261816, 0.040065735180693 },
+  { 0.878020569812172, 0.035369071097592 },
+  { 0.910959724904127, 0.030479240699603 },
+  { 0.938923557354988, 0.025422959526114 },
+  { 0.961759365338203, 0.020227869569052 },
+  { 0.979342508063747, 0.014922443697356 },
+  { 0.991577288340860, 0.009536220301750 },
+  { 0.998399618990061, 0.004105998604650 }
+};
+
+static double2 std_pts_84_85_1d[] = 
+{
+  { -0.998472332242509, 0.003919490253844 },
+  { -0.991959557593243, 0.009103996637401 },
+  { -0.980278220980255, 0.014248756431576 },
+  { -0.963486613014079, 0.019319901423684 },
+  { -0.941671956847637, 0.024290456613838 },
+  { -0.914947907206138, 0.029134413261499 },
+  { -0.883453765218616, 0.033826492086861 },
+  { -0.847353716209314, 0.038342222194132 },
+  { -0.806835964136938, 0.042658057197981 },
+  { -0.762111747194955, 0.046751494754346 },
+  { -0.713414235268957, 0.050601192784390 },
+  { -0.660997313751498, 0.054187080318881 },
+  { -0.605134259639600, 0.057490461956910 },
+  { -0.546116316660085, 0.060494115249991 },
+  { -0.484251176785735, 0.063182380449396 },
+  { -0.419861376029269, 0.065541242126323 },
+  { -0.353282612864304, 0.067558402229365 },
+  { -0.284861998032914, 0.069223344193657 },
+  { -0.214956244860518, 0.070527387765085 },
+  { -0.143929809510713, 0.071463734252514 },
+  { -0.072152990874586, 0.072027501971422 },
+  { 0.000000000000000, 0.072215751693799 },
+  { 0.072152990874586, 0.072027501971422 },
+  { 0.143929809510713, 0.071463734252515 },
+  { 0.214956244860518, 0.070527387765085 },
+  { 0.284861998032914, 0.069223344193656 },
+  { 0.353282612864304, 0.067558402229366 },
+  { 0.419861376029269, 0.065541242126323 },
+  { 0.484251176785734, 0.063182380449396 },
+  { 0.546116316660084, 0.060494115249991 },
+  { 0.605134259639602, 0.057490461956911 },
+  { 0.660997313751499, 0.054187080318882 },
+  { 0.713414235268957, 0.050601192784389 },
+  { 0.762111747194955, 0.046751494754348 },
+  { 0.806835964136939, 0.042658057197982 },
+  { 0.847353716209315, 0.038342222194132 },
+  { 0.883453765218617, 0.033826492086860 },
+  { 0.914947907206138, 0.029134413261498 },
+  { 0.941671956847638, 0.024290456613840 },
+  { 0.963486613014080, 0.019319901423685 },
+  { 0.980278220980256, 0.014248756431575 },
+  { 0.991959557593245, 0.009103996637402 },
+  { 0.998472332242508, 0.003919490253845 }
+};
+
+static double2 std_pts_86_87_1d[] = 
+{
+  { -0.998540200636774, 0.003745404803113 },
+  { -0.992316392138515, 0.008700481367525 },
+  { -0.981151833077914, 0.013619586755580 },
+  { -0.965099650422494, 0.018471481736816 },
+  { -0.944239509118193, 0.023231481902019 },
+  { -0.918675259984175, 0.027875782821280 },
+  { -0.888534238286043, 0.032381222812070 },
+  { -0.853966595004710, 0.036725347813809 },
+  { -0.815144539645136, 0.040886512310346 },
+  { -0.772261479248755, 0.044843984081969 },
+  { -0.725531053660717, 0.048578046448353 },
+  { -0.675186070666122, 0.052070096091704 },
+  { -0.621477345903576, 0.055302735563728 },
+  { -0.564672453185471, 0.058259859877595 },
+  { -0.505054391388203, 0.060926736701562 },
+  { -0.442920174525412, 0.063290079733204 },
+  { -0.378579352014707, 0.065338114879181 },
+  { -0.312352466502786, 0.067060638906293 },
+  { -0.244569456928201, 0.068449070269367 },
+  { -0.175568014775517, 0.069496491861572 },
+  { -0.105691901708653, 0.070197685473558 },
+  { -0.035289236964135, 0.070549157789354 },
+  { 0.035289236964135, 0.070549157789354 },
+  { 0.105691901708653, 0.070197685473558 },
+  { 0.175568014775517, 0.069496491861573 },
+  { 0.244569456928201, 0.068449070269366 },
+  { 0.312352466502786, 0.067060638906294 },
+  { 0.378579352014707, 0.065338114879182 },
+  { 0.442920174525411, 0.063290079733203 },
+  { 0.505054391388202, 0.060926736701562 },
+  { 0.564672453185470, 0.058259859877597 },
+  { 0.621477345903575, 0.055302735563727 },
+  { 0.675186070666123, 0.052070096091705 },
+  { 0.725531053660717, 0.048578046448353 },
+  { 0.772261479248755, 0.044843984081969 },
+  { 0.815144539645135, 0.040886512310346 },
+  { 0.853966595004710, 0.036725347813811 },
+  { 0.888534238286043, 0.032381222812070 },
+  { 0.918675259984175, 0.027875782821280 },
+  { 0.944239509118195, 0.023231481902019 },
+  { 0.965099650422493, 0.018471481736814 },
+  { 0.981151833077914, 0.013619586755580 },
+  { 0.992316392138515, 0.008700481367526 },
+  { 0.998540200636773, 0.003745404803113 }
+};
+
+static double2 std_pts_88_89_1d[] = 
+{
+  { -0.998603645181936, 0.003582663155283 },
+  { -0.992649998447203, 0.008323189296218 },
+  { -0.981968715034541, 0.013031104991584 },
+  { -0.966608310396894, 0.017677535257937 },
+  { -0.946641690995629, 0.022239847550578 },
+  { -0.922163936719000, 0.026696213967577 },
+  { -0.893291671753243, 0.031025374934517 },
+  { -0.860162475960665, 0.035206692201609 },
+  { -0.822934220502087, 0.039220236729303 },
+  { -0.781784312593906, 0.043046880709164 },
+  { -0.736908848945490, 0.046668387718373 },
+  { -0.688521680771201, 0.050067499237952 },
+  { -0.636853394453223, 0.053228016731268 },
+  { -0.582150212569353, 0.056134878759786 },
+  { -0.524672820462916, 0.058774232718842 },
+  { -0.464695123919635, 0.061133500831067 },
+  { -0.402502943858542, 0.063201440073820 },
+  { -0.338392654250602, 0.064968195750723 },
+  { -0.272669769752377, 0.066425348449842 },
+  { -0.205647489783264, 0.067565954163608 },
+  { -0.137645205983253, 0.068384577378670 },
+  { -0.068986980163144, 0.068877316977661 },
+  { -0.000000000000000, 0.069041824829232 },
+  { 0.068986980163144, 0.068877316977662 },
+  { 0.137645205983253, 0.068384577378670 },
+  { 0.205647489783264, 0.067565954163607 },
+  { 0.272669769752378, 0.066425348449842 },
+  { 0.338392654250602, 0.064968195750723 },
+  { 0.402502943858542, 0.063201440073820 },
+  { 0.464695123919635, 0.061133500831067 },
+  { 0.524672820462916, 0.058774232718842 },
+  { 0.582150212569353, 0.056134878759787 },
+  { 0.636853394453224, 0.053228016731268 },
+  { 0.688521680771201, 0.050067499237953 },
+  { 0.736908848945490, 0.046668387718375 },
+  { 0.781784312593907, 0.043046880709165 },
+  { 0.822934220502087, 0.039220236729302 },
+  { 0.860162475960664, 0.035206692201608 },
+  { 0.893291671753242, 0.031025374934517 },
+  { 0.922163936719001, 0.026696213967578 },
+  { 0.946641690995630, 0.022239847550579 },
+  { 0.966608310396894, 0.017677535257939 },
+  { 0.981968715034539, 0.013031104991580 },
+  { 0.992649998447204, 0.008323189296220 },
+  { 0.998603645181937, 0.003582663155283 }
+};
+
+static double2 std_pts_90_91_1d[] = 
+{
+  { -0.998663042133818, 0.003430300868106 },
+  { -0.992962348906174, 0.007969898229726 },
+  { -0.982733669804167, 0.012479883770988 },
+  { -0.968021391853992, 0.016933514007837 },
+  { -0.948892363446090, 0.021309998754137 },
+  { -0.925433798806754, 0.025589286397130 },
+  { -0.897752711533943, 0.029751829552203 },
+  { -0.865975394866858, 0.033778627999107 },
+  { -0.830246837066067, 0.037651305357387 },
+  { -0.790730057075275, 0.041352190109679 },
+  { -0.747605359615666, 0.044864395277318 },
+  { -0.701069512020407, 0.048171895101712 },
+  { -0.651334846201997, 0.051259598007144 },
+  { -0.598628289712715, 0.054113415385856 },
+  { -0.543190330261802, 0.056720325843991 },
+  { -0.485273918388165, 0.059068434595547 },
+  { -0.425143313282828, 0.061147027724650 },
+  { -0.363072877020996, 0.062946621064394 },
+  { -0.299345822701870, 0.064459003467139 },
+  { -0.234252922206270, 0.065677274267781 },
+  { -0.168091179467103, 0.066595874768455 },
+  { -0.101162475305584, 0.067210613600679 },
+  { -0.033772190016052, 0.067518685849036 },
+  { 0.033772190016052, 0.067518685849037 },
+  { 0.101162475305584, 0.067210613600678 },
+  { 0.168091179467103, 0.066595874768455 },
+  { 0.234252922206270, 0.065677274267781 },
+  { 0.299345822701870, 0.064459003467139 },
+  { 0.363072877020996, 0.062946621064394 },
+  { 0.425143313282829, 0.061147027724650 },
+  { 0.485273918388164, 0.059068434595546 },
+  { 0.543190330261802, 0.056720325843991 },
+  { 0.598628289712716, 0.054113415385856 },
+  { 0.651334846201998, 0.051259598007143 },
+  { 0.701069512020406, 0.048171895101713 },
+  { 0.747605359615666, 0.044864395277318 },
+  { 0.790730057075275, 0.041352190109678 },
+  { 0.830246837066066, 0.037651305357386 },
+  { 0.865975394866858, 0.033778627999106 },
+  { 0.897752711533942, 0.029751829552203 },
+  { 0.925433798806753, 0.025589286397129 },
+  { 0.948892363446090, 0.021309998754136 },
+  { 0.968021391853993, 0.016933514007838 },
+  { 0.982733669804167, 0.012479883770990 },
+  { 0.992962348906174, 0.007969898229725 },
+  { 0.998663042133818, 0.003430300868108 }
+};
+
+static double2 std_pts_92_93_1d[] = 
+{
+  { -0.998718728584214, 0.003287453842528 },
+  { -0.993255210987770, 0.007638616295848 },
+  { -0.983451003071625, 0.011962848464314 },
+  { -0.969346787326566, 0.016235333146435 },
+  { -0.951003969257710, 0.020436938147668 },
+  { -0.928502693012360, 0.024549211659657 },
+  { -0.901941329438525, 0.028554150700643 },
+  { -0.871436015796897, 0.032434235515186 },
+  { -0.837120139899903, 0.036172496584175 },
+  { -0.799143754167742, 0.039752586122530 },
+  { -0.757672918445440, 0.043158848648480 },
+  { -0.712888973409064, 0.046376389086505 },
+  { -0.664987747390333, 0.049391137747361 },
+  { -0.614178699956374, 0.052189911780057 },
+  { -0.560684005934664, 0.054760472781530 },
+  { -0.504737583863577, 0.057091580293232 },
+  { -0.446584073104855, 0.059173040942340 },
+  { -0.386477764084667, 0.060995753008739 },
+  { -0.324681486337736, 0.062551746220922 },
+  { -0.261465459214974, 0.063834216605717 },
+  { -0.197106110279112, 0.064837556238946 },
+  { -0.131884866554515, 0.065557377766550 },
+  { -0.066086923916356, 0.065990533588811 },
+  { -0.000000000000000, 0.066135129623656 },
+  { 0.066086923916356, 0.065990533588811 },
+  { 0.131884866554515, 0.065557377766550 },
+  { 0.197106110279112, 0.064837556238945 },
+  { 0.261465459214974, 0.063834216605717 },
+  { 0.324681486337736, 0.062551746220922 },
+  { 0.386477764084668, 0.060995753008740 },
+  { 0.446584073104856, 0.059173040942339 },
+  { 0.504737583863578, 0.057091580293232 },
+  { 0.560684005934664, 0.054760472781530 },
+  { 0.614178699956374, 0.052189911780057 },
+  { 0.664987747390333, 0.049391137747362 },
+  { 0.712888973409064, 0.046376389086507 },
+  { 0.757672918445437, 0.043158848648478 },
+  { 0.799143754167742, 0.039752586122531 },
+  { 0.837120139899902, 0.036172496584175 },
+  { 0.871436015796897, 0.032434235515185 },
+  { 0.901941329438525, 0.028554150700645 },
+  { 0.928502693012360, 0.024549211659660 },
+  { 0.951003969257708, 0.020436938147666 },
+  { 0.969346787326564, 0.016235333146432 },
+  { 0.983451003071623, 0.011962848464313 },
+  { 0.993255210987767, 0.007638616295847 },
+  { 0.998718728584211, 0.003287453842529 }
+};
+
+static double2 std_pts_94_95_1d[] = 
+{
+  { -0.998771007252427, 0.003153346052306 },
+  { -0.993530172266351, 0.007327553901276 },
+  { -0.984124583722827, 0.011477234579235 },
+  { -0.970591592546247, 0.015579315722943 },
+  { -0.952987703160432, 0.019616160457356 },
+  { -0.931386690706555, 0.023570760839325 },
+  { -0.905879136715570, 0.027426509708356 },
+  { -0.876572020274248, 0.031167227832798 },
+  { -0.843588261624393, 0.034777222564771 },
+  { -0.807066204029441, 0.038241351065830 },
+  { -0.767159032515739, 0.041545082943465 },
+  { -0.724034130923814, 0.044674560856694 },
+  { -0.677872379632664, 0.047616658492490 },
+  { -0.628867396776513, 0.050359035553854 },
+  { -0.577224726083973, 0.052890189485193 },
+  { -0.523160974722233, 0.055199503699984 },
+  { -0.466902904750958, 0.057277292100403 },
+  { -0.408686481990717, 0.059114839698396 },
+  { -0.348755886292161, 0.060704439165894 },
+  { -0.287362487355455, 0.062039423159893 },
+  { -0.224763790394689, 0.063114192286254 },
+  { -0.161222356068892, 0.063924238584648 },
+  { -0.097004699209463, 0.064466164435950 },
+  { -0.032380170962869, 0.064737696812684 },
+  { 0.032380170962869, 0.064737696812683 },
+  { 0.097004699209463, 0.064466164435950 },
+  { 0.161222356068892, 0.063924238584648 },
+  { 0.224763790394689, 0.063114192286254 },
+  { 0.287362487355455, 0.062039423159892 },
+  { 0.348755886292161, 0.060704439165894 },
+  { 0.408686481990716, 0.059114839698395 },
+  { 0.466902904750958, 0.057277292100402 },
+  { 0.523160974722233, 0.055199503699985 },
+  { 0.577224726083973, 0.052890189485193 },
+  { 0.628867396776514, 0.050359035553856 },
+  { 0.677872379632664, 0.047616658492489 },
+  { 0.724034130923814, 0.044674560856693 },
+  { 0.767159032515740, 0.041545082943464 },
+  { 0.807066204029443, 0.038241351065833 },
+  { 0.843588261624393, 0.034777222564771 },
+  { 0.876572020274247, 0.031167227832797 },
+  { 0.905879136715569, 0.027426509708356 },
+  { 0.931386690706555, 0.023570760839323 },
+  { 0.952987703160431, 0.019616160457355 },
+  { 0.970591592546248, 0.015579315722943 },
+  { 0.984124583722827, 0.011477234579234 },
+  { 0.993530172266351, 0.007327553901277 },
+  { 0.998771007252426, 0.003153346052309 }
+};
+
+static double2 std_pts_96_97_1d[] = 
+{
+  { -0.998820150606634, 0.003027278988923 },
+  { -0.993788661944168, 0.007035099590085 },
+  { -0.984757895914214, 0.011020551031595 },
+  { -0.971762200901556, 0.014962144935626 },
+  { -0.954853658674138, 0.018843595853090 },
+  { -0.934100294755810, 0.022649201587446 },
+  { -0.909585655828073, 0.026363618927067 },
+  { -0.881408445573009, 0.029971884620584 },
+  { -0.849682119844165, 0.033459466791623 },
+  { -0.814534427359855, 0.036812320963000 },
+  { -0.776106894345446, 0.040016945766373 },
+  { -0.734554254237403, 0.043060436981260 },
+  { -0.690043824425131, 0.045930539355596 },
+  { -0.642754832419237, 0.048615695887828 },
+  { -0.592877694108901, 0.051105094330144 },
+  { -0.540613246991726, 0.053388710708259 },
+  { -0.486171941452492, 0.055457349674804 },
+  { -0.429772993341576, 0.057302681530187 },
+  { -0.371643501262285, 0.058917275760027 },
+  { -0.312017532119749, 0.060294630953152 },
+  { -0.251135178612577, 0.061429200979193 },
+  { -0.189241592461814, 0.062316417320057 },
+  { -0.126585997269672, 0.062952707465196 },
+  { -0.063420684982687, 0.063335509296491 },
+  { 0.000000000000000, 0.063463281404791 },
+  { 0.063420684982687, 0.063335509296492 },
+  { 0.126585997269672, 0.062952707465196 },
+  { 0.189241592461814, 0.062316417320057 },
+  { 0.251135178612577, 0.061429200979193 },
+  { 0.312017532119749, 0.060294630953152 },
+  { 0.371643501262285, 0.058917275760027 },
+  { 0.429772993341576, 0.057302681530187 },
+  { 0.486171941452493, 0.055457349674804 },
+  { 0.540613246991727, 0.053388710708259 },
+  { 0.592877694108901, 0.051105094330145 },
+  { 0.642754832419237, 0.048615695887828 },
+  { 0.690043824425133, 0.045930539355595 },
+  { 0.734554254237403, 0.043060436981260 },
+  { 0.776106894345447, 0.040016945766375 },
+  { 0.814534427359855, 0.036812320963000 },
+  { 0.849682119844165, 0.033459466791621 },
+  { 0.881408445573008, 0.029971884620583 },
+  { 0.909585655828073, 0.026363618927065 },
+  { 0.934100294755810, 0.022649201587447 },
+  { 0.954853658674137, 0.018843595853088 },
+  { 0.971762200901556, 0.014962144935626 },
+  { 0.984757895914213, 0.011020551031595 },
+  { 0.993788661944166, 0.007035099590086 },
+  { 0.998820150606635, 0.003027278988923 }
+};
+
+static double2 std_pts_98_99_1d[] = 
+{
+  { -0.998866404420071, 0.002908622553155 },
+  { -0.994031969432090, 0.006759799195744 },
+  { -0.985354084048005, 0.010590548383652 },
+  { -0.972864385106692, 0.014380822761486 },
+  { -0.956610955242807, 0.018115560713490 },
+  { -0.936656618944878, 0.021780243170124 },
+  { -0.913078556655792, 0.025360673570011 },
+  { -0.885967979523614, 0.028842993580536 },
+  { -0.855429769429947, 0.032213728223578 },
+  { -0.821582070859337, 0.035459835615147 },
+  { -0.784555832900399, 0.038568756612587 },
+  { -0.744494302226069, 0.041528463090147 },
+  { -0.701552468706822, 0.044327504338804 },
+  { -0.655896465685439, 0.046955051303948 },
+  { -0.607702927184950, 0.049400938449466 },
+  { -0.557158304514650, 0.051655703069582 },
+  { -0.504458144907464, 0.053710621888996 },
+  { -0.449806334974039, 0.055557744806213 },
+  { -0.393414311897565, 0.057189925647728 },
+  { -0.335500245419437, 0.058600849813222 },
+  { -0.276288193779532, 0.059785058704266 },
+  { -0.216007236876042, 0.060737970841771 },
+  { -0.154890589998146, 0.061455899590317 },
+  { -0.093174701560086, 0.061936067420683 },
+  { -0.031098338327189, 0.062176616655347 },
+  { 0.031098338327189, 0.062176616655347 },
+  { 0.093174701560086, 0.061936067420683 },
+  { 0.154890589998146, 0.061455899590317 },
+  { 0.216007236876042, 0.060737970841770 },
+  { 0.276288193779532, 0.059785058704265 },
+  { 0.335500245419438, 0.058600849813222 },
+  { 0.393414311897566, 0.057189925647729 },
+  { 0.449806334974039, 0.055557744806212 },
+  { 0.504458144907464, 0.053710621888996 },
+  { 0.557158304514650, 0.051655703069582 },
+  { 0.607702927184949, 0.049400938449465 },
+  { 0.655896465685439, 0.046955051303947 },
+  { 0.701552468706823, 0.044327504338805 },
+  { 0.744494302226068, 0.041528463090148 },
+  { 0.784555832900399, 0.038568756612586 },
+  { 0.821582070859336, 0.035459835615147 },
+  { 0.855429769429946, 0.032213728223578 },
+  { 0.885967979523613, 0.028842993580536 },
+  { 0.913078556655792, 0.025360673570014 },
+  { 0.936656618944878, 0.021780243170123 },
+  { 0.956610955242808, 0.018115560713488 },
+  { 0.972864385106692, 0.014380822761485 },
+  { 0.985354084048005, 0.010590548383654 },
+  { 0.994031969432090, 0.006759799195745 },
+  { 0.998866404420071, 0.002908622553154 }
+};
+
+static double2* std_tables_1d[] =
+{
+  std_pts_0_1_1d,   std_pts_0_1_1d,
+  std_pts_2_3_1d,   std_pts_2_3_1d,
+  std_pts_4_5_1d,   std_pts_4_5_1d,
+  std_pts_6_7_1d,   std_pts_6_7_1d,
+  std_pts_8_9_1d,   std_pts_8_9_1d,
+  std_pts_10_11_1d, std_pts_10_11_1d,
+  std_pts_12_13_1d, std_pts_12_13_1d,
+  std_pts_14_15_1d, std_pts_14_15_1d,
+  std_pts_16_17_1d, std_pts_16_17_1d,
+  std_pts_18_19_1d, std_pts_18_19_1d,
+  std_pts_20_21_1d, std_pts_20_21_1d,
+  std_pts_22_23_1d, std_pts_22_23_1d,
+  std_pts_24_25_1d, std_pts_24_25_1d,
+  std_pts_26_27_1d, std_pts_26_27_1d,
+  std_pts_28_29_1d, std_pts_28_29_1d,
+  std_pts_30_31_1d, std_pts_30_31_1d, 
+  std_pts_32_33_1d, std_pts_32_33_1d, 
+  std_pts_34_35_1d, std_pts_34_35_1d, 
+  std_pts_36_37_1d, std_pts_36_37_1d, 
+  std_pts_38_39_1d, std_pts_38_39_1d, 
+  std_pts_40_41_1d, std_pts_40_41_1d, 
+  std_pts_42_43_1d, std_pts_42_43_1d, 
+  std_pts_44_45_1d, std_pts_44_45_1d, 
+  std_pts_46_47_1d, std_pts_46_47_1d, 
+  std_pts_48_49_1d, std_pts_48_49_1d, 
+  std_pts_50_51_1d, std_pts_50_51_1d, 
+  std_pts_52_53_1d, std_pts_52_53_1d, 
+  std_pts_54_55_1d, std_pts_54_55_1d, 
+  std_pts_56_57_1d, std_pts_56_57_1d, 
+  std_pts_58_59_1d, std_pts_58_59_1d, 
+  std_pts_60_61_1d, std_pts_60_61_1d, 
+  std_pts_62_63_1d, std_pts_62_63_1d, 
+  std_pts_64_65_1d, std_pts_64_65_1d, 
+  std_pts_66_67_1d, std_pts_66_67_1d,
+  std_pts_68_69_1d, std_pts_68_69_1d, 
+  std_pts_70_71_1d, std_pts_70_71_1d, 
+  std_pts_72_73_1d, std_pts_72_73_1d, 
+  std_pts_74_75_1d, std_pts_74_75_1d, 
+  std_pts_76_77_1d, std_pts_76_77_1d, 
+  std_pts_78_79_1d, std_pts_78_79_1d, 
+  std_pts_80_81_1d, std_pts_80_81_1d, 
+  std_pts_82_83_1d, std_pts_82_83_1d, 
+  std_pts_84_85_1d, std_pts_84_85_1d, 
+  std_pts_86_87_1d, std_pts_86_87_1d, 
+  std_pts_88_89_1d, std_pts_88_89_1d, 
+  std_pts_90_91_1d, std_pts_90_91_1d, 
+  std_pts_92_93_1d, std_pts_92_93_1d, 
+  std_pts_94_95_1d, std_pts_94_95_1d, 
+  std_pts_96_97_1d, std_pts_96_97_1d, 
+  std_pts_98_99_1d, std_pts_98_99_1d
+
+};
+
+
+static int std_np_1d[] =
+{
+  sizeof(std_pts_0_1_1d) / sizeof(double2),
+  sizeof(std_pts_0_1_1d) / sizeof(double2),
+  sizeof(std_pts_2_3_1d) / sizeof(double2),
+  sizeof(std_pts_2_3_1d) / sizeof(double2),
+  sizeof(std_pts_4_5_1d) / sizeof(double2),
+  sizeof(std_pts_4_5_1d) / sizeof(double2),
+  sizeof(std_pts_6_7_1d) / sizeof(double2),
+  sizeof(std_pts_6_7_1d) / sizeof(double2),
+  sizeof(std_pts_8_9_1d) / sizeof(double2),
+  sizeof(std_pts_8_9_1d) / sizeof(double2),
+  sizeof(std_pts_10_11_1d) / sizeof(double2),
+  sizeof(std_pts_10_11_1d) / sizeof(double2),
+  sizeof(std_pts_12_13_1d) / sizeof(double2),
+  sizeof(std_pts_12_13_1d) / sizeof(double2),
+  sizeof(std_pts_14_15_1d) / sizeof(double2),
+  sizeof(std_pts_14_15_1d) / sizeof(double2),
+  sizeof(std_pts_16_17_1d) / sizeof(double2),
+  sizeof(std_pts_16_17_1d) / sizeof(double2),
+  sizeof(std_pts_18_19_1d) / sizeof(double2),
+  sizeof(std_pts_18_19_1d) / sizeof(double2),
+  sizeof(std_pts_20_21_1d) / sizeof(double2),
+  sizeof(std_pts_20_21_1d) / sizeof(double2),
+  sizeof(std_pts_22_23_1d) / sizeof(double2),
+  sizeof(std_pts_22_23_1d) / sizeof(double2),
+  sizeof(std_pts_24_25_1d) / sizeof(double2),
+  sizeof(std_pts_24_25_1d) / sizeof(double2),
+  sizeof(std_pts_26_27_1d) / sizeof(double2),
+  sizeof(std_pts_26_27_1d) / sizeof(double2),
+  sizeof(std_pts_28_29_1d) / sizeof(double2),
+  sizeof(std_pts_28_29_1d) / sizeof(double2),
+  sizeof(std_pts_30_31_1d) / sizeof(double2),
+  sizeof(std_pts_30_31_1d) / sizeof(double2),
+  sizeof(std_pts_32_33_1d) / sizeof(double2),
+  sizeof(std_pts_32_33_1d) / sizeof(double2),
+  sizeof(std_pts_34_35_1d) / sizeof(double2),
+  sizeof(std_pts_34_35_1d) / sizeof(double2),
+  sizeof(std_pts_36_37_1d) / sizeof(double2),
+  sizeof(std_pts_36_37_1d) / sizeof(double2),
+  sizeof(std_pts_38_39_1d) / sizeof(double2),
+  sizeof(std_pts_38_39_1d) / sizeof(double2),
+  sizeof(std_pts_40_41_1d) / sizeof(double2),
+  sizeof(std_pts_40_41_1d) / sizeof(double2),
+  sizeof(std_pts_42_43_1d) / sizeof(double2),
+  sizeof(std_pts_42_43_1d) / sizeof(double2),
+  sizeof(std_pts_44_45_1d) / sizeof(double2),
+  sizeof(std_pts_44_45_1d) / sizeof(double2),
+  sizeof(std_pts_46_47_1d) / sizeof(double2),
+  sizeof(std_pts_46_47_1d) / sizeof(double2),
+  sizeof(std_pts_48_49_1d) / sizeof(double2),
+  sizeof(std_pts_48_49_1d) / sizeof(double2),
+  sizeof(std_pts_50_51_1d) / sizeof(double2),
+  sizeof(std_pts_50_51_1d) / sizeof(double2),
+  sizeof(std_pts_52_53_1d) / sizeof(double2),
+  sizeof(std_pts_52_53_1d) / sizeof(double2),
+  sizeof(std_pts_54_55_1d) / sizeof(double2),
+  sizeof(std_pts_54_55_1d) / sizeof(double2),
+  sizeof(std_pts_56_57_1d) / sizeof(double2),
+  sizeof(std_pts_56_57_1d) / sizeof(double2),
+  sizeof(std_pts_58_59_1d) / sizeof(double2),
+  sizeof(std_pts_58_59_1d) / sizeof(double2),
+  sizeof(std_pts_60_61_1d) / sizeof(double2),
+  sizeof(std_pts_60_61_1d) / sizeof(double2),
+  sizeof(std_pts_62_63_1d) / sizeof(double2),
+  sizeof(std_pts_62_63_1d) / sizeof(double2),
+  sizeof(std_pts_64_65_1d) / sizeof(double2),
+  sizeof(std_pts_64_65_1d) / sizeof(double2),
+  sizeof(std_pts_66_67_1d) / sizeof(double2),
+  sizeof(std_pts_66_67_1d) / sizeof(double2),
+  sizeof(std_pts_68_69_1d) / sizeof(double2),
+  sizeof(std_pts_68_69_1d) / sizeof(double2),
+  sizeof(std_pts_70_71_1d) / sizeof(double2),
+  sizeof(std_pts_70_71_1d) / sizeof(double2),
+  sizeof(std_pts_72_73_1d) / sizeof(double2),
+  sizeof(std_pts_72_73_1d) / sizeof(double2),
+  sizeof(std_pts_74_75_1d) / sizeof(double2),
+  sizeof(std_pts_74_75_1d) / sizeof(double2),
+  sizeof(std_pts_76_77_1d) / sizeof(double2),
+  sizeof(std_pts_76_77_1d) / sizeof(double2),
+  sizeof(std_pts_78_79_1d) / sizeof(double2),
+  sizeof(std_pts_78_79_1d) / sizeof(double2),
+  sizeof(std_pts_80_81_1d) / sizeof(double2),
+  sizeof(std_pts_80_81_1d) / sizeof(double2),
+  sizeof(std_pts_82_83_1d) / sizeof(double2),
+  sizeof(std_pts_82_83_1d) / sizeof(double2),
+  sizeof(std_pts_84_85_1d) / sizeof(double2),
+  sizeof(std_pts_84_85_1d) / sizeof(double2),
+  sizeof(std_pts_86_87_1d) / sizeof(double2),
+  sizeof(std_pts_86_87_1d) / sizeof(double2),
+  sizeof(std_pts_88_89_1d) / sizeof(double2),
+  sizeof(std_pts_88_89_1d) / sizeof(double2),
+  sizeof(std_pts_90_91_1d) / sizeof(double2),
+  sizeof(std_pts_90_91_1d) / sizeof(double2),
+  sizeof(std_pts_92_93_1d) / sizeof(double2),
+  sizeof(std_pts_92_93_1d) / sizeof(double2),
+  sizeof(std_pts_94_95_1d) / sizeof(double2),
+  sizeof(std_pts_94_95_1d) / sizeof(double2),
+  sizeof(std_pts_96_97_1d) / sizeof(double2),
+  sizeof(std_pts_96_97_1d) / sizeof(double2),
+  sizeof(std_pts_98_99_1d) / sizeof(double2),
+  sizeof(std_pts_98_99_1d) / sizeof(double2)
+};
+
+
+Quad1DStd::Quad1DStd()
+{
+  tables = std_tables_1d;
+  np = std_np_1d;
+  ref_vert[0] = -1.0;
+  ref_vert[1] = 1.0;
+  max_order = 99;
+}
+
+Quad1DStd g_quad_1d_std;
@@ -0,0 +1,54 @@
+#include "sequencing.h"
+#include "frontal.h"
+#include "projection.h"
+
+// Newton's method on one mesh, starting from 'y'; returns the number of
+// iterations or -1
+static int newton(Mesh *mesh, ensemble_setup setup, void *params, double *y,
+        double tol, int max_iter)
+{
+  DiscreteProblem dp(mesh->get_n_eqn(), mesh);
+  setup(&dp, params);
+  FrontalSolver solver(&dp);
+  int n_dof = mesh->get_n_dof();
+  double *dy = new double[n_dof];
+  int iter = -1;
+  for (int it=0; it<=max_iter; it++) {
+    double res_norm = solver.solve(y, dy);
+    if (res_norm < tol) {
+      iter = it;
+      break;
+    }
+    if (!(res_norm < 1e100)) break;  // diverged
+    for (int i=0; i<n_dof; i++) y[i] += dy[i];
+  }
+  delete [] dy;
+  return iter;
+}
+
+int solve_nested(int n_levels, Mesh **meshes, ensemble_setup setup,
+        void *params, double *y, double tol, int max_iter, int *iterations)
+{
+  if (n_levels < 1) error("solve_nested: no meshes.");
+  double *y_prev = NULL;
+  int total = 0;
+  for (int l=0; l<n_levels; l++) {
+    int n_dof = meshes[l]->get_n_dof();
+    double *y_l = l == n_levels-1 ? y : new double[n_dof];
+    if (l == 0)
+      for (int i=0; i<n_dof; i++) y_l[i] = 0;
+    else {
+      transfer_solution(meshes[l-1], y_prev, meshes[l], y_l);
+      delete [] y_prev;
+    }
+    int it = newton(meshes[l], setup, params, y_l, tol, max_iter);
+    if (iterations != NULL) iterations[l] = it;
+    if (it < 0) {
+      if (y_l != y) delete [] y_l;
+      return -1;
+    }
+    total += it;
+    y_prev = y_l;
+  }
+  return total;
+}
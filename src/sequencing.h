@@ -0,0 +1,26 @@
+#ifndef _SEQUENCING_H_
+#define _SEQUENCING_H_
+
+#include "ensemble.h"
+
+/// \brief Mesh sequencing (nested iteration) for nonlinear problems.
+///
+/// Solves the problem on meshes[0], ..., meshes[n_levels-1], each of which
+/// has to be a refinement of the previous one (see create_refined_mesh()).
+/// The problem on every mesh is set up by 'setup' with the parameters
+/// 'params' and solved by Newton's method with a FrontalSolver, until the
+/// L2 norm of the residual is below tol. Newton's method starts from zero
+/// on the coarsest mesh and from the solution of the previous mesh on the
+/// others (transferred exactly by transfer_solution()), so that most
+/// iterations are done on the cheap coarse meshes and a few on the fine
+/// ones.
+///
+/// On return, 'y' holds the solution on the finest mesh. If 'iterations'
+/// is not NULL, it receives the numbers of Newton iterations of the levels.
+/// Returns the total number of Newton iterations, or -1 if Newton's method
+/// did not converge on some level (then 'y' is undefined).
+int solve_nested(int n_levels, Mesh **meshes, ensemble_setup setup,
+                 void *params, double *y, double tol=1e-8, int max_iter=50,
+                 int *iterations=NULL);
+
+#endif